@@ -214,6 +214,14 @@ static const uint8_t indexhtm[] PROGMEM={
 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F,
+0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x61, 0x72, 0x72, 0x44, 0x65, 0x70, 0x22, 0x3E, 0x20, 0x53, 0x68, 0x6F, 0x77, 0x20,
+0x61, 0x72, 0x72, 0x69, 0x76, 0x61, 0x6C, 0x73, 0x20, 0x61, 0x73, 0x20, 0x77, 0x65, 0x6C, 0x6C, 0x20, 0x61, 0x73, 0x20, 0x64,
+0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x28, 0x4E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x52,
+0x61, 0x69, 0x6C, 0x29, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22,
+0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F,
 0x78, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22,
 0x3E, 0x20, 0x49, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x65, 0x61,
 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x4E, 0x61, 0x74, 0x69,
@@ -800,305 +808,309 @@ static const uint8_t indexhtm[] PROGMEM={
 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62,
 0x6C, 0x65, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x42, 0x75, 0x73, 0x29, 0x3B,
 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22,
-0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x75, 0x70,
-0x64, 0x61, 0x74, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x2C,
-0x20, 0x73, 0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x24, 0x28, 0x27, 0x23, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C,
-0x28, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x23, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C,
-0x28, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F,
-0x72, 0x73, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x6F,
-0x61, 0x72, 0x64, 0x4D, 0x6F, 0x64, 0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B,
-0x62, 0x6F, 0x78, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x21,
-0x21, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61,
-0x6D, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53,
-0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61,
-0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64,
-0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74,
-0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D,
-0x2E, 0x6C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x69, 0x66, 0x20, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x4C, 0x4F, 0x4E, 0x44, 0x4F, 0x4E, 0x5F, 0x55, 0x4E, 0x44, 0x45, 0x52, 0x47,
-0x52, 0x4F, 0x55, 0x4E, 0x44, 0x22, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C,
-0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74,
-0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C,
-0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65,
-0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E,
-0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72,
-0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E,
-0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D,
-0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63,
-0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64,
-0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20,
-0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x74,
-0x65, 0x6D, 0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x54,
-0x66, 0x4C, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65,
-0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C, 0x20, 0x3D, 0x20,
-0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
-0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62,
-0x65, 0x49, 0x64, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x69, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x61, 0x72, 0x72, 0x44, 0x65, 0x70, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x61, 0x72, 0x72, 0x44, 0x65, 0x70, 0x29, 0x3B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E,
+0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x22, 0x2C, 0x20, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61,
+0x74, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62,
+0x6F, 0x78, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x2C, 0x20, 0x73,
+0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+0x28, 0x27, 0x23, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x73,
+0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x24, 0x28, 0x27, 0x23, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x73,
+0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x73, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73,
+0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x42, 0x6F, 0x61, 0x72,
+0x64, 0x4D, 0x6F, 0x64, 0x65, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F,
+0x78, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x21, 0x21, 0x76,
+0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65,
+0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65,
+0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x20, 0x3D,
+0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69,
-0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x61, 0x74, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F,
-0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28,
-0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63,
-0x68, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
-0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70,
-0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65,
-0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
-0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69,
-0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
-0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C,
-0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-0x54, 0x66, 0x4C, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29,
-0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
-0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C,
-0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73,
-0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x54, 0x66, 0x4C, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
-0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53,
-0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72,
-0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70,
-0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x22, 0x22,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C,
-0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53,
-0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73,
-0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61,
-0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69,
-0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73,
-0x73, 0x43, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x68, 0x69, 0x73,
-0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
-0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68,
-0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x3B, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60, 0x2F, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E,
-0x65, 0x73, 0x73, 0x3F, 0x62, 0x3D, 0x24, 0x7B, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x7D, 0x60, 0x29,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x61, 0x76, 0x65, 0x28,
-0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20,
-0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x63, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
-0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x73, 0x2E, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74,
-0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x73, 0x2E, 0x6C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61,
-0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61,
-0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72,
-0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43,
-0x72, 0x73, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x49, 0x64, 0x20, 0x3D,
-0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x49, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53,
-0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x73, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75,
-0x62, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67,
-0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72, 0x69,
-0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28,
-0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x44, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x44, 0x61, 0x74, 0x65, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x42, 0x75, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x29, 0x3B, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68,
-0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
-0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20,
-0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65,
-0x61, 0x74, 0x68, 0x65, 0x72, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x6C, 0x65,
-0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2E, 0x76, 0x61,
-0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45,
-0x6E, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77,
-0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x73, 0x61, 0x76, 0x65, 0x73, 0x65, 0x74, 0x74, 0x69,
-0x6E, 0x67, 0x73, 0x27, 0x2C, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65,
-0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79,
-0x28, 0x73, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3B,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29,
-0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65,
-0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-0x60, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69,
-0x6E, 0x67, 0x73, 0x3A, 0x20, 0x24, 0x7B, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x29,
+0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C,
+0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x4C, 0x4F, 0x4E, 0x44, 0x4F, 0x4E, 0x5F, 0x55, 0x4E, 0x44, 0x45, 0x52, 0x47, 0x52, 0x4F,
+0x55, 0x4E, 0x44, 0x22, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74,
+0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x74,
+0x72, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61,
+0x76, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75,
+0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53,
+0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29, 0x20,
+0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C,
+0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D,
+0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
+0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x69, 0x74,
+0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
+0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D,
+0x2E, 0x63, 0x72, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20,
+0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x54, 0x66, 0x4C,
+0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29,
+0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C, 0x20, 0x3D, 0x20, 0x74, 0x72,
+0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74,
+0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x49,
+0x64, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x69, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
+0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75,
+0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x61, 0x74, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67,
+0x69, 0x74, 0x75, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x42, 0x75, 0x74, 0x74,
+0x6F, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64,
+0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x74,
+0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4E,
+0x61, 0x6D, 0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E,
+0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D,
+0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53,
+0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68,
+0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F,
+0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74,
+0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
+0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
+0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74,
+0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65,
-0x64, 0x28, 0x69, 0x64, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
-0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68,
-0x6F, 0x77, 0x28, 0x69, 0x64, 0x2C, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E,
-0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x62, 0x6C, 0x6F, 0x63,
-0x6B, 0x22, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64,
-0x29, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x6E, 0x6F,
-0x6E, 0x65, 0x22, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F,
-0x20, 0x4D, 0x65, 0x6E, 0x75, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61,
-0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43,
-0x68, 0x65, 0x63, 0x6B, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65,
-0x74, 0x63, 0x68, 0x28, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x61, 0x70, 0x69, 0x2E, 0x67, 0x69, 0x74, 0x68,
-0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63, 0x2D, 0x75, 0x6B,
-0x2F, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2F, 0x72, 0x65, 0x6C,
-0x65, 0x61, 0x73, 0x65, 0x73, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29,
-0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x46, 0x61, 0x69,
-0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65,
-0x73, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-0x6E, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x47, 0x69, 0x74, 0x48, 0x75, 0x62, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20,
-0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65,
-0x73, 0x74, 0x54, 0x61, 0x67, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x74, 0x61, 0x67, 0x5F, 0x6E, 0x61, 0x6D, 0x65,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66, 0x69, 0x72,
-0x6D, 0x77, 0x61, 0x72, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x44, 0x65, 0x73, 0x63, 0x20, 0x3D, 0x20,
-0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x63,
-0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x43, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63,
-0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x20, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-0x6F, 0x6E, 0x73, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D,
-0x20, 0x73, 0x74, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x2F, 0x42, 0x28, 0x5C, 0x64, 0x2B, 0x5C, 0x2E, 0x5C, 0x64,
-0x2B, 0x29, 0x2D, 0x57, 0x28, 0x5C, 0x64, 0x2B, 0x5C, 0x2E, 0x5C, 0x64, 0x2B, 0x29, 0x2F, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
-0x3F, 0x20, 0x7B, 0x20, 0x42, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x6D, 0x61, 0x74,
-0x63, 0x68, 0x5B, 0x31, 0x5D, 0x29, 0x2C, 0x20, 0x57, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74,
-0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x5B, 0x32, 0x5D, 0x29, 0x20, 0x7D, 0x20, 0x3A, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73,
-0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x29, 0x3B, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
-0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6E, 0x74, 0x54, 0x61, 0x67, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
-0x66, 0x20, 0x28, 0x21, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
-0x74, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74,
-0x28, 0x22, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F,
-0x72, 0x6D, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C,
-0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x42, 0x20, 0x3E, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x42, 0x20, 0x7C,
-0x7C, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2E, 0x57, 0x20, 0x3E, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E,
-0x57, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63,
-0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x60, 0x41, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x6F, 0x20,
-0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x24, 0x7B, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x7D, 0x20,
-0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x42, 0x72, 0x69, 0x65,
-0x66, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x24, 0x7B, 0x6C, 0x61, 0x74,
-0x65, 0x73, 0x74, 0x44, 0x65, 0x73, 0x63, 0x7D, 0x22, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x5C,
-0x27, 0x4F, 0x4B, 0x5C, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20,
-0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x5C, 0x27, 0x43, 0x61, 0x6E, 0x63, 0x65,
-0x6C, 0x5C, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x2E, 0x60, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6F, 0x74,
-0x61, 0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D,
-0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65,
-0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D,
-0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28,
-0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
-0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E,
-0x69, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20,
-0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73,
-0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28,
-0x22, 0x4E, 0x6F, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65,
-0x2E, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
-0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61,
-0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x65, 0x72, 0x72, 0x29, 0x3B, 0x0D, 0x0A,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20,
-0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x3A,
-0x20, 0x22, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x57,
-0x69, 0x66, 0x69, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F,
-0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79,
-0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69,
-0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x65, 0x72, 0x61, 0x73, 0x65, 0x77, 0x69, 0x66, 0x69,
-0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73,
-0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C,
-0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27,
-0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x69, 0x46, 0x69, 0x3A, 0x20,
-0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72,
-0x74, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-0x20, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75,
-0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72,
-0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74,
-0x27, 0x2C, 0x20, 0x7B, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29,
-0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73,
+0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x54, 0x66,
+0x4C, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x6F, 0x73, 0x74, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x20, 0x7B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
+0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C, 0x29, 0x20,
+0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73,
+0x65, 0x61, 0x72, 0x63, 0x68, 0x4E, 0x61, 0x6D, 0x65, 0x54, 0x66, 0x4C, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20,
+0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C,
+0x65, 0x63, 0x74, 0x65, 0x64, 0x54, 0x66, 0x4C, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x46, 0x69,
+0x6C, 0x74, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74,
+0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69,
+0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61,
+0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C,
+0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70,
+0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x43,
+0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+0x74, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x76,
+0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65,
+0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E,
+0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x60, 0x2F, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73,
+0x73, 0x3F, 0x62, 0x3D, 0x24, 0x7B, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x65, 0x73, 0x73, 0x7D, 0x60, 0x29, 0x3B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66,
+0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x53, 0x61, 0x76, 0x65, 0x28, 0x29, 0x20,
+0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70,
+0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70,
+0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x63, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74,
+0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x43, 0x52, 0x53, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x73, 0x2E, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x6F, 0x6E, 0x4C, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+0x2E, 0x6C, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x6F, 0x6E, 0x4C, 0x6F, 0x6E, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70,
+0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73, 0x20,
+0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x72, 0x73,
+0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x49, 0x64, 0x20, 0x3D, 0x20, 0x61,
+0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x49, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x73, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61,
+0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+0x2E, 0x74, 0x75, 0x62, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x75, 0x62, 0x65,
+0x4D, 0x6F, 0x64, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x62, 0x72, 0x69, 0x67, 0x68,
+0x74, 0x6E, 0x65, 0x73, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65,
+0x6E, 0x61, 0x62, 0x6C, 0x65, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x44, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65,
+0x64, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x44, 0x61, 0x74, 0x65, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x73, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x42, 0x75, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65,
+0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x42, 0x75, 0x73, 0x65, 0x73, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x61, 0x72, 0x72, 0x44, 0x65, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63,
+0x6B, 0x65, 0x64, 0x28, 0x22, 0x61, 0x72, 0x72, 0x44, 0x65, 0x70, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64,
+0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x22, 0x29, 0x3B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x73, 0x43,
+0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x22, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72,
+0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61,
+0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+0x74, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2E, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x73, 0x20, 0x3D,
+0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x73, 0x6C,
+0x65, 0x65, 0x70, 0x45, 0x6E, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66,
+0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x73, 0x61, 0x76, 0x65, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x27, 0x2C,
+0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A,
+0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79,
+0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F,
+0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79,
+0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x73, 0x29, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
+0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x60, 0x46, 0x61, 0x69, 0x6C,
+0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x20,
+0x24, 0x7B, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x7D, 0x60, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x28, 0x69, 0x64, 0x29,
+0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x6F, 0x63, 0x75,
+0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69,
+0x64, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x69, 0x64,
+0x2C, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x73, 0x68, 0x6F, 0x77, 0x6D, 0x65, 0x29, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65,
+0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x3B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x2E, 0x73, 0x74, 0x79,
+0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x4D, 0x65, 0x6E, 0x75,
+0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20,
+0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x55,
+0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79,
+0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73,
+0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22,
+0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x61, 0x70, 0x69, 0x2E, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F,
+0x6D, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x2F, 0x67, 0x61, 0x64, 0x65, 0x63, 0x2D, 0x75, 0x6B, 0x2F, 0x64, 0x65, 0x70, 0x61,
+0x72, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2D, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73,
+0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F,
+0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74,
+0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x72, 0x65,
+0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x72, 0x6F,
+0x6D, 0x20, 0x47, 0x69, 0x74, 0x48, 0x75, 0x62, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
+0x20, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67,
+0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x74, 0x61, 0x67, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61,
+0x67, 0x20, 0x3D, 0x20, 0x61, 0x70, 0x70, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
+0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x44, 0x65, 0x73, 0x63, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E,
+0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x21, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+0x74, 0x54, 0x61, 0x67, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C,
+0x65, 0x72, 0x74, 0x28, 0x22, 0x43, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72,
+0x65, 0x20, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x22,
+0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B,
+0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+0x3D, 0x20, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E,
+0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x2F, 0x42, 0x28, 0x5C, 0x64, 0x2B, 0x5C, 0x2E, 0x5C, 0x64, 0x2B, 0x29, 0x2D, 0x57, 0x28,
+0x5C, 0x64, 0x2B, 0x5C, 0x2E, 0x5C, 0x64, 0x2B, 0x29, 0x2F, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3F, 0x20, 0x7B, 0x20, 0x42,
+0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x5B, 0x31, 0x5D,
+0x29, 0x2C, 0x20, 0x57, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x6D, 0x61, 0x74, 0x63,
+0x68, 0x5B, 0x32, 0x5D, 0x29, 0x20, 0x7D, 0x20, 0x3A, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+0x73, 0x74, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72, 0x73,
+0x69, 0x6F, 0x6E, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x70,
+0x61, 0x72, 0x73, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61,
+0x67, 0x29, 0x3B, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6C,
+0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x46, 0x69, 0x72,
+0x6D, 0x77, 0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20,
+0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D,
+0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74,
+0x2E, 0x42, 0x20, 0x3E, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x42, 0x20, 0x7C, 0x7C, 0x20, 0x6C, 0x61, 0x74,
+0x65, 0x73, 0x74, 0x2E, 0x57, 0x20, 0x3E, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2E, 0x57, 0x29, 0x20, 0x7B, 0x0D,
+0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72,
+0x6D, 0x28, 0x60, 0x41, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
+0x6F, 0x6E, 0x20, 0x24, 0x7B, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x54, 0x61, 0x67, 0x7D, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76,
+0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x42, 0x72, 0x69, 0x65, 0x66, 0x20, 0x64, 0x65, 0x73,
+0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x24, 0x7B, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x44, 0x65,
+0x73, 0x63, 0x7D, 0x22, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x5C, 0x27, 0x4F, 0x4B, 0x5C, 0x27,
+0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74,
+0x65, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x5C, 0x27, 0x43, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x5C, 0x27, 0x20, 0x74,
+0x6F, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x2E, 0x60, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6F, 0x74, 0x61, 0x27, 0x2C, 0x20, 0x7B,
+0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73,
 0x20, 0x3D, 0x3E, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C,
-0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27,
-0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x79, 0x73, 0x74,
-0x65, 0x6D, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29,
-0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A,
-0x20, 0x20, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0D,
-0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D,
+0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E,
+0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x74,
+0x69, 0x6E, 0x67, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D,
+0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0D, 0x0A,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x4E, 0x6F, 0x20, 0x75,
+0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x59, 0x6F, 0x75,
+0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74,
+0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x22, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
+0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F,
+0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x65, 0x72, 0x72, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x22, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B,
+0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x3A, 0x20, 0x22, 0x20, 0x2B, 0x20,
+0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x65, 0x61, 0x72, 0x57, 0x69, 0x66, 0x69, 0x28, 0x29,
+0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D,
+0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61,
+0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x73, 0x65, 0x74, 0x74,
+0x69, 0x6E, 0x67, 0x73, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x65, 0x72, 0x61, 0x73, 0x65, 0x77, 0x69, 0x66, 0x69, 0x27, 0x2C, 0x20, 0x7B, 0x20,
+0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72,
+0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D,
+0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63,
+0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72,
+0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x69, 0x46, 0x69, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x65,
+0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x53, 0x79, 0x73, 0x74,
+0x65, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6E,
+0x66, 0x69, 0x72, 0x6D, 0x28, 0x27, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x79, 0x6F,
+0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65,
+0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3F, 0x27, 0x29, 0x29, 0x20, 0x7B, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x27, 0x2C, 0x20, 0x7B, 0x20,
+0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x20, 0x7D, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3E, 0x20, 0x72,
+0x65, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x6D,
+0x73, 0x67, 0x29, 0x29, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x63, 0x61, 0x74, 0x63,
+0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x3E, 0x20, 0x61, 0x6C, 0x65, 0x72, 0x74, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72,
+0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3A, 0x20, 0x27,
+0x20, 0x2B, 0x20, 0x65, 0x72, 0x72, 0x2E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x29, 0x3B, 0x0D, 0x0A, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0D, 0x0A, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x2F, 0x73,
+0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x68, 0x74,
+0x6D, 0x6C, 0x3E
 };
@@ -13,6 +13,9 @@
 #include <JsonListener.h>
 #include <WiFiClientSecure.h>
 #include <stationData.h>
+#include <httpChunkDecoder.h>
+#include <httpInflater.h>
+#include <requestBudget.h>
 
 TfLdataClient::TfLdataClient() {}
 
@@ -21,16 +24,29 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     unsigned long perfTimer=millis();
     long dataReceived = 0;
     bool bChunked = false;
+    uint8_t contentEncoding = ENCODING_IDENTITY;
     lastErrorMsg = "";
+    lastBytesReceived = 0;
+    lastBytesDecoded = 0;
+    lastCompressed = false;
 
     JsonStreamingParser parser;
     parser.setListener(this);
+    httpChunkDecoder dechunker;
+    httpInflater inflater;      // The inflate window is only held for the duration of the update
+    String acceptEncoding = inflater.begin() ? F("\r\nAccept-Encoding: gzip") : F("");
     WiFiClientSecure httpsClient;
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
     station->boardChanged=false;
 
+    // The arrivals and the disruption messages are two requests, so both have to be in the budget before the first
+    if (!apiBudget.acquire(UPSTREAM_TFL,2)) {
+        lastErrorMsg = "Request budget used up, next request allowed in " + String(apiBudget.getWait(UPSTREAM_TFL,2) / 1000) + F("s");
+        return UPD_THROTTLED;
+    }
+
     int retryCounter=0;
     while (!httpsClient.connect(apiHost,443) && (retryCounter++ < 15)){
         delay(200);
@@ -39,7 +55,7 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         lastErrorMsg = F("Connection timeout");
         return UPD_NO_RESPONSE;
     }
-    String request = "GET /StopPoint/" + String(locationId) + F("/Arrivals?app_key=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
+    String request = "GET /StopPoint/" + String(locationId) + F("/Arrivals?app_key=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + acceptEncoding + F("\r\nConnection: close\r\n\r\n");
     httpsClient.print(request);
     Xcb();
     unsigned long ticker = millis()+800;
@@ -58,9 +74,16 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     // Parse status code
     String statusLine = httpsClient.readStringUntil('\n');
     if (!statusLine.startsWith(F("HTTP/")) || statusLine.indexOf(F("200 OK")) == -1) {
+        if (statusLine.indexOf(F(" 429")) > 0) {
+            // Too many requests isn't a problem with the key, so wait as long as asked rather than show the key error
+            apiBudget.rateLimited(UPSTREAM_TFL,requestBudget::readRetryAfter(httpsClient));
+            httpsClient.stop();
+            lastErrorMsg = statusLine;
+            return UPD_THROTTLED;
+        }
         httpsClient.stop();
 
-        if (statusLine.indexOf(F("401")) > 0 || statusLine.indexOf(F("429")) > 0) {
+        if (statusLine.indexOf(F("401")) > 0) {
             lastErrorMsg = F("Not Authorized");
             return UPD_UNAUTHORISED;
         } else if (statusLine.indexOf(F("500")) > 0) {
@@ -72,17 +95,29 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         }
     }
 
+    apiBudget.succeeded(UPSTREAM_TFL);
+
     // Skip the remaining headers
     while (httpsClient.connected() || httpsClient.available()) {
         String line = httpsClient.readStringUntil('\n');
         if (line == F("\r")) break;
         if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+        else if (line.startsWith(F("Content-Encoding:"))) contentEncoding = httpInflater::parseEncoding(line.substring(17));
+    }
+
+    if (!inflater.reset(contentEncoding)) {
+        httpsClient.stop();
+        lastErrorMsg = F("Unsupported Content-Encoding");
+        return UPD_DATA_ERROR;
     }
 
     bool isBody = false;
-    char c;
+    dechunker.reset(bChunked);
+    if (capture) capture->start("tflarrivals",contentEncoding != ENCODING_IDENTITY);
     id=0;
     maxServicesRead = false;
+    jsonDepth = 0;
+    jsonComplete = false;
     xStation.numServices = 0;
     xMessages.numMessages = 0;
     for (int i=0;i<MAXBOARDMESSAGES;i++) strcpy(xMessages.messages[i],"");
@@ -91,10 +126,20 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
         while(httpsClient.available() && !maxServicesRead) {
-            c = httpsClient.read();
-            dataReceived++;
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            int bytesRead = httpsClient.read((uint8_t *)readBuffer, sizeof(readBuffer));
+            if (bytesRead <= 0) break;
+            dataReceived += bytesRead;
+            size_t bodyBytes = dechunker.filter(readBuffer, bytesRead);     // Chunk framing isn't part of the body
+            if (capture) capture->write(readBuffer, bodyBytes);
+            inflater.write(readBuffer, bodyBytes);
+            char *json;
+            size_t jsonBytes;
+            while (!maxServicesRead && (jsonBytes = inflater.read(&json)) > 0) {
+                for (size_t i=0;i<jsonBytes && !maxServicesRead;i++) {
+                    if (json[i] == '{' || json[i] == '[') isBody = true;
+                    if (isBody) parser.parse(json[i]);
+                }
+            }
             if (millis()>ticker) {
                 Xcb();
                 ticker = millis()+800;
@@ -102,14 +147,30 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         }
         delay(25);
     }
+    if (capture) capture->end();
     httpsClient.stop();
+    lastBytesReceived = dataReceived;
+    lastBytesDecoded = inflater.getBytesOut();
+    lastCompressed = inflater.isCompressed();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg = F("Timed out during data receive operation - ");
         lastErrorMsg += String(dataReceived) + F(" bytes received");
         return UPD_TIMEOUT;
     }
+    if (!maxServicesRead && !jsonComplete) {
+        // The connection dropped before the end of the response, so we don't have all the arrivals
+        lastErrorMsg = F("Incomplete response - ");
+        lastErrorMsg += String(dataReceived) + F(" bytes received");
+        if (inflater.isError()) lastErrorMsg += F(", invalid gzip data");
+        return UPD_INCOMPLETE;
+    }
 
     // Update the distruption messages
+    if (!apiBudget.acquire(UPSTREAM_TFL)) {
+        lastErrorMsg = "Request budget used up [msgs], next request allowed in " + String(apiBudget.getWait(UPSTREAM_TFL) / 1000) + F("s");
+        return UPD_THROTTLED;
+    }
+    retryCounter=0;
     while (!httpsClient.connect(apiHost, 443) && (retryCounter++ < 15)){
         delay(200);
     }
@@ -117,7 +178,7 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         lastErrorMsg = F("Connection timeout [msgs]");
         return UPD_NO_RESPONSE;
     }
-    request = "GET /StopPoint/" + String(locationId) + F("/Disruption?getFamily=true&flattenResponse=true&app_key=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
+    request = "GET /StopPoint/" + String(locationId) + F("/Disruption?getFamily=true&flattenResponse=true&app_key=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + acceptEncoding + F("\r\nConnection: close\r\n\r\n");
     httpsClient.print(request);
     retryCounter=0;
     while(!httpsClient.available() && retryCounter++ < 40) {
@@ -134,6 +195,12 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     // Parse status code
     statusLine = httpsClient.readStringUntil('\n');
     if (!statusLine.startsWith(F("HTTP/")) || statusLine.indexOf(F("200 OK")) == -1) {
+        if (statusLine.indexOf(F(" 429")) > 0) {
+            apiBudget.rateLimited(UPSTREAM_TFL,requestBudget::readRetryAfter(httpsClient));
+            httpsClient.stop();
+            lastErrorMsg = statusLine;
+            return UPD_THROTTLED;
+        }
         httpsClient.stop();
 
         if (statusLine.indexOf(F("401")) > 0) {
@@ -148,25 +215,50 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         }
     }
 
+    apiBudget.succeeded(UPSTREAM_TFL);
+
     // Skip the remaining headers
+    bChunked = false;
+    contentEncoding = ENCODING_IDENTITY;
     while (httpsClient.connected() || httpsClient.available()) {
         String line = httpsClient.readStringUntil('\n');
         if (line == F("\r")) break;
         if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+        else if (line.startsWith(F("Content-Encoding:"))) contentEncoding = httpInflater::parseEncoding(line.substring(17));
+    }
+
+    if (!inflater.reset(contentEncoding)) {
+        httpsClient.stop();
+        lastErrorMsg = F("Unsupported Content-Encoding [msgs]");
+        return UPD_DATA_ERROR;
     }
 
     isBody = false;
+    dechunker.reset(bChunked);
+    if (capture) capture->start("tflstatus",contentEncoding != ENCODING_IDENTITY);
     id=0;
     maxServicesRead = false;
+    jsonDepth = 0;
+    jsonComplete = false;
     parser.reset();
 
     dataSendTimeout = millis() + 10000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
         while(httpsClient.available() && !maxServicesRead) {
-            c = httpsClient.read();
-            dataReceived++;
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            int bytesRead = httpsClient.read((uint8_t *)readBuffer, sizeof(readBuffer));
+            if (bytesRead <= 0) break;
+            dataReceived += bytesRead;
+            size_t bodyBytes = dechunker.filter(readBuffer, bytesRead);     // Chunk framing isn't part of the body
+            if (capture) capture->write(readBuffer, bodyBytes);
+            inflater.write(readBuffer, bodyBytes);
+            char *json;
+            size_t jsonBytes;
+            while (!maxServicesRead && (jsonBytes = inflater.read(&json)) > 0) {
+                for (size_t i=0;i<jsonBytes && !maxServicesRead;i++) {
+                    if (json[i] == '{' || json[i] == '[') isBody = true;
+                    if (isBody) parser.parse(json[i]);
+                }
+            }
             if (millis()>ticker) {
                 Xcb();
                 ticker = millis()+800;
@@ -174,12 +266,22 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
         }
         delay(25);
     }
+    if (capture) capture->end();
     httpsClient.stop();
+    lastBytesReceived = dataReceived;
+    lastBytesDecoded += inflater.getBytesOut();
+    lastCompressed = lastCompressed || inflater.isCompressed();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg = F("Timed out during msgs data receive operation - ");
         lastErrorMsg += String(dataReceived) + F(" bytes received");
         return UPD_TIMEOUT;
     }
+    if (!maxServicesRead && !jsonComplete) {
+        lastErrorMsg = F("Incomplete response [msgs] - ");
+        lastErrorMsg += String(dataReceived) + F(" bytes received");
+        if (inflater.isError()) lastErrorMsg += F(", invalid gzip data");
+        return UPD_INCOMPLETE;
+    }
 
     // Sort the services by arrival time
     size_t arraySize = xStation.numServices;
@@ -189,20 +291,22 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     if (xStation.numServices > MAXBOARDSERVICES) xStation.numServices = MAXBOARDSERVICES;
 
     // Check if any of the services have changed
-    if (xStation.numServices != station->numServices) station->boardChanged=true;
+    if (xStation.numServices != lastNumServices) station->boardChanged=true;
     else {
         for (int i=0;i<xStation.numServices;i++) {
             if (i>1) break; // Only check first two services
-            if (strcmp(xStation.service[i].destinationName,station->service[i].destination)) {
+            if (strcmp(xStation.service[i].destinationName,lastDestination[i])) {
                 station->boardChanged=true;
                 break;
             }
         }
     }
+    lastNumServices = xStation.numServices;
+    for (int i=0;i<xStation.numServices && i<2;i++) strcpy(lastDestination[i],xStation.service[i].destinationName);
 
     // Remove line break formatting from messages
     for (int i=0;i<xMessages.numMessages;i++) {
-        replaceWord(xMessages.messages[i],"\\n","");
+        messageText.normalise(xMessages.messages[i]);
     }
 
     // Update the callers data with the new data
@@ -215,7 +319,6 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     messages->numMessages = xMessages.numMessages;
     for (int i=0;i<xMessages.numMessages;i++) strcpy(messages->messages[i],xMessages.messages[i]);
 
-    if (bChunked) lastErrorMsg = "WARNING: Chunked response! ";
     if (station->boardChanged) {
         lastErrorMsg += F("SUCCESS [Primary Service Changed] Update took: ");
         lastErrorMsg += String(millis() - perfTimer) + F("ms [") + String(dataReceived) + F("]");
@@ -227,46 +330,16 @@ int TfLdataClient::updateArrivals(rdStation *station, stnMessages *messages, con
     }
 }
 
-//
-// Function to prune messages from the point at which a word or phrase is found
-//
-bool TfLdataClient::pruneFromPhrase(char* input, const char* target) {
-    // Find the first occurance of the target word or phrase
-    char* pos = strstr(input,target);
-    // If found, prune from here
-    if (pos) {
-        input[pos - input] = '\0';
-        return true;
-    }
-    return false;
+// Custom comparator function to compare time to station
+bool TfLdataClient::compareTimes(const ugService& a, const ugService& b) {
+    return a.timeToStation < b.timeToStation;
 }
 
 //
-// Function to replace occurrences of a word or phrase in a character array
+// Sets where the body of each response is kept as it's received (nullptr for nowhere)
 //
-void TfLdataClient::replaceWord(char* input, const char* target, const char* replacement) {
-    // Find the first occurrence of the target word
-    char* pos = strstr(input, target);
-    while (pos) {
-        // Calculate the length of the target word
-        size_t targetLen = strlen(target);
-        // Calculate the length difference between target and replacement
-        int diff = strlen(replacement) - targetLen;
-
-        // Shift the remaining characters to accommodate the replacement
-        memmove(pos + strlen(replacement), pos + targetLen, strlen(pos + targetLen) + 1);
-
-        // Copy the replacement word into the position
-        memcpy(pos, replacement, strlen(replacement));
-
-        // Find the next occurrence of the target word
-        pos = strstr(pos + strlen(replacement), target);
-    }
-}
-
-// Custom comparator function to compare time to station
-bool TfLdataClient::compareTimes(const ugService& a, const ugService& b) {
-    return a.timeToStation < b.timeToStation;
+void TfLdataClient::setCapture(responseCapture *capture) {
+    this->capture = capture;
 }
 
 void TfLdataClient::whitespace(char c) {}
@@ -320,12 +393,20 @@ void TfLdataClient::value(String value) {
     }
 }
 
-void TfLdataClient::endArray() {}
+void TfLdataClient::endArray() {
+    if (jsonDepth > 0 && --jsonDepth == 0) jsonComplete = true;
+}
 
-void TfLdataClient::endObject() {}
+void TfLdataClient::endObject() {
+    if (jsonDepth > 0 && --jsonDepth == 0) jsonComplete = true;
+}
 
 void TfLdataClient::endDocument() {}
 
-void TfLdataClient::startArray() {}
+void TfLdataClient::startArray() {
+    jsonDepth++;
+}
 
-void TfLdataClient::startObject() {}
+void TfLdataClient::startObject() {
+    jsonDepth++;
+}
@@ -12,11 +12,14 @@
 #include <JsonListener.h>
 #include <JsonStreamingParser.h>
 #include <stationData.h>
+#include <textNormaliser.h>
+#include <responseCapture.h>
 
 typedef void (*tflClientCallback) ();
 
 #define MAXLINESIZE 20
 #define UGMAXREADSERVICES 20
+#define TFLREADBUFFERSIZE 512   // Socket reads are decoded in blocks of this size
 
 class TfLdataClient: public JsonListener {
 
@@ -39,19 +42,28 @@ class TfLdataClient: public JsonListener {
 
         int id=0;
         bool maxServicesRead = false;
+        int jsonDepth = 0;              // Open objects/arrays in the response being parsed
+        bool jsonComplete = false;      // The response's outermost object/array has been closed
         ugStation xStation;
         stnMessages xMessages;
+        char readBuffer[TFLREADBUFFERSIZE];
+        int lastNumServices = 0;                    // The board last returned, the caller's copy may be an older one
+        char lastDestination[2][MAXLOCATIONSIZE] = {};
+        textNormaliser messageText{TEXT_ESCAPES};  // Removes the line break formatting from messages
+        responseCapture *capture = nullptr;         // Where responses are kept for debugging, if anywhere
 
         //tflClientCallback Xcb;
-        bool pruneFromPhrase(char* input, const char* target);
-        void replaceWord(char* input, const char* target, const char* replacement);
         static bool compareTimes(const ugService& a, const ugService& b);
 
     public:
         String lastErrorMsg = "";
+        long lastBytesReceived = 0;     // Size of the last update's responses as sent, and once inflated
+        uint32_t lastBytesDecoded = 0;
+        bool lastCompressed = false;
 
         TfLdataClient();
         int updateArrivals(rdStation *station, stnMessages *messages, const char *locationId, String apiKey, tflClientCallback Xcb);
+        void setCapture(responseCapture *capture);
 
         virtual void whitespace(char c);
         virtual void startDocument();
@@ -0,0 +1,32 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Board Buffer Library - double buffered board data, so an update is published whole instead of copied.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <boardBuffer.h>
+
+boardBuffer::boardBuffer() {
+    memset(boards, 0, sizeof(boards));    // Both boards start empty, with no location, services or messages
+    published = 0;
+}
+
+//
+// The board to fill with the next update. It isn't shown until publish() is called.
+//
+stnBoard *boardBuffer::back() {
+    return &boards[published ^ 1];
+}
+
+const stnBoard *boardBuffer::current() {
+    return &boards[published];
+}
+
+void boardBuffer::publish() {
+    published ^= 1;
+}
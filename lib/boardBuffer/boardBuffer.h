@@ -0,0 +1,38 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Board Buffer Library - double buffered board data, so an update is published whole instead of copied.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <stationData.h>
+
+//
+// Holds two complete boards. One is published and is what the display reads, the other is the back board that
+// a data client fills with the next update. Once the update has succeeded publish() swaps them over, so the
+// display never sees a half written board and nothing has to be copied:
+//
+//   stnBoard *next = board.back();
+//   if (client.update(&next->station, &next->messages, ...) == UPD_SUCCESS) board.publish();
+//
+// The board that was published before stays unchanged until the next update starts filling it, so anything
+// still pointing into it must have moved on to current() by then.
+//
+class boardBuffer {
+    private:
+        stnBoard boards[2];
+        std::atomic<uint8_t> published;    // Index of the board being displayed
+
+    public:
+        boardBuffer();
+        stnBoard *back();
+        const stnBoard *current();
+        void publish();
+};
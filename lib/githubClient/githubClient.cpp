@@ -15,6 +15,8 @@
 #include <WiFiClientSecure.h>
 #include <LittleFS.h>
 #include <md5Utils.h>
+#include <httpChunkDecoder.h>
+#include <requestBudget.h>
 
 github::github(String token) {
     accessToken = token;            // Initialise with a GitHub token if the repository is private
@@ -30,6 +32,11 @@ bool github::getLatestRelease() {
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
+    if (!apiBudget.acquire(UPSTREAM_GITHUB)) {
+        lastErrorMsg += F("Request budget used up");
+        return false;
+    }
+
     int retryCounter=0; //retry counter
     while((!httpsClient.connect(apiHost, 443)) && (retryCounter < 30)){
         delay(200);
@@ -57,16 +64,19 @@ bool github::getLatestRelease() {
         }
     }
 
+    bool bChunked = false;
     while (httpsClient.connected()) {
         String line = httpsClient.readStringUntil('\n');
         // check for success code...
         if (line.startsWith("HTTP")) {
             if (line.indexOf("200 OK") == -1) {
+            if (line.indexOf(F(" 429")) > 0) apiBudget.rateLimited(UPSTREAM_GITHUB,requestBudget::readRetryAfter(httpsClient));
             httpsClient.stop();
             lastErrorMsg += line;
             return false;
             }
-        }
+            apiBudget.succeeded(UPSTREAM_GITHUB);
+        } else if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
         if (line == "\r") {
             // Headers received
             break;
@@ -79,12 +89,15 @@ bool github::getLatestRelease() {
     releaseDescription="";
     releaseAssets=0;
     unsigned long dataReceived = 0;
+    httpChunkDecoder dechunker;
+    dechunker.reset(bChunked);
 
     unsigned long dataSendTimeout = millis() + 12000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
         while(httpsClient.available()) {
             c = httpsClient.read();
             dataReceived++;
+            if (!dechunker.filter(c)) continue;   // Chunk framing, not part of the body
             if (c == '{' || c == '[') isBody = true;
             if (isBody) parser.parse(c);
         }
@@ -0,0 +1,148 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * HTTP Chunk Decoder Library - removes the chunked Transfer-Encoding framing from a response body as it's read.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <httpChunkDecoder.h>
+
+httpChunkDecoder::httpChunkDecoder() {
+    reset(false);
+}
+
+//
+// Start a new response body, isChunked being whether the headers gave "Transfer-Encoding: chunked"
+//
+void httpChunkDecoder::reset(bool isChunked) {
+    chunked = isChunked;
+    state = CHUNK_SIZE;
+    chunkRemaining = 0;
+    sizeDigits = 0;
+}
+
+int httpChunkDecoder::hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+//
+// Filters a block of socket data in place, returning how many bytes of body are now at the start of buf.
+// Chunk data is moved down with a single memmove per run rather than byte by byte.
+//
+size_t httpChunkDecoder::filter(char *buf, size_t len) {
+    if (!chunked) return len;
+
+    size_t out = 0;
+    size_t i = 0;
+    while (i < len) {
+        if (state == CHUNK_DATA) {
+            size_t count = len - i;
+            if (count > chunkRemaining) count = chunkRemaining;
+            if (out != i) memmove(buf + out, buf + i, count);
+            out += count;
+            i += count;
+            chunkRemaining -= count;
+            if (chunkRemaining == 0) state = CHUNK_DATA_CR;
+        } else {
+            if (filter(buf[i])) buf[out++] = buf[i];
+            i++;
+        }
+    }
+    return out;
+}
+
+//
+// Filters a single character of socket data, returning true if it's part of the body
+//
+bool httpChunkDecoder::filter(char c) {
+    if (!chunked) return true;
+
+    int digit;
+    switch (state) {
+        case CHUNK_SIZE:
+            digit = hexValue(c);
+            if (digit >= 0) {
+                if (sizeDigits >= 7) {
+                    state = CHUNK_ERROR;    // Far bigger than anything we'd ever be sent
+                } else {
+                    chunkRemaining = (chunkRemaining << 4) | digit;
+                    sizeDigits++;
+                }
+            } else if (sizeDigits == 0) {
+                state = CHUNK_ERROR;
+            } else if (c == ';' || c == ' ' || c == '\t') {
+                state = CHUNK_EXTENSION;
+            } else if (c == '\r') {
+                state = CHUNK_SIZE_LF;
+            } else if (c == '\n') {
+                state = chunkRemaining ? CHUNK_DATA : CHUNK_TRAILER;
+            } else {
+                state = CHUNK_ERROR;
+            }
+            return false;
+
+        case CHUNK_EXTENSION:
+            if (c == '\n') state = chunkRemaining ? CHUNK_DATA : CHUNK_TRAILER;
+            return false;
+
+        case CHUNK_SIZE_LF:
+            if (c == '\n') state = chunkRemaining ? CHUNK_DATA : CHUNK_TRAILER;
+            else state = CHUNK_ERROR;
+            return false;
+
+        case CHUNK_DATA:
+            if (--chunkRemaining == 0) state = CHUNK_DATA_CR;
+            return true;
+
+        case CHUNK_DATA_CR:
+            if (c == '\r') state = CHUNK_DATA_LF;
+            else if (c == '\n') state = CHUNK_SIZE;
+            else state = CHUNK_ERROR;
+            sizeDigits = 0;
+            return false;
+
+        case CHUNK_DATA_LF:
+            if (c == '\n') state = CHUNK_SIZE;
+            else state = CHUNK_ERROR;
+            return false;
+
+        case CHUNK_TRAILER:
+            // A blank line ends the body, anything else is a trailer field that we don't need
+            if (c == '\r') state = CHUNK_TRAILER_LF;
+            else if (c == '\n') state = CHUNK_DONE;
+            else state = CHUNK_TRAILER_LINE;
+            return false;
+
+        case CHUNK_TRAILER_LINE:
+            if (c == '\n') state = CHUNK_TRAILER;
+            return false;
+
+        case CHUNK_TRAILER_LF:
+            if (c == '\n') state = CHUNK_DONE;
+            else state = CHUNK_ERROR;
+            return false;
+
+        default:
+            // Nothing after the end of the body (or an error) is passed on
+            return false;
+    }
+}
+
+//
+// True once the zero length chunk and any trailers have been read. For a response that isn't chunked the
+// decoder can't tell where the body ends, so this is always false.
+//
+bool httpChunkDecoder::isComplete() {
+    return chunked && state == CHUNK_DONE;
+}
+
+bool httpChunkDecoder::isError() {
+    return chunked && state == CHUNK_ERROR;
+}
@@ -0,0 +1,48 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * HTTP Chunk Decoder Library - removes the chunked Transfer-Encoding framing from a response body as it's read.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define CHUNK_SIZE 0        // Reading the chunk size (hex digits)
+#define CHUNK_EXTENSION 1   // Skipping a chunk extension, up to the end of the size line
+#define CHUNK_SIZE_LF 2     // Expecting the LF at the end of the size line
+#define CHUNK_DATA 3        // Passing chunk data through
+#define CHUNK_DATA_CR 4     // Expecting the CRLF that follows the chunk data
+#define CHUNK_DATA_LF 5
+#define CHUNK_TRAILER 6     // At the start of a trailer line (or the blank line that ends the body)
+#define CHUNK_TRAILER_LINE 7 // Skipping a trailer field
+#define CHUNK_TRAILER_LF 8  // Expecting the LF of the final blank line
+#define CHUNK_DONE 9        // The last chunk and trailers have been read
+#define CHUNK_ERROR 10      // The framing is invalid, nothing more is passed through
+
+//
+// Sits between the socket and a parser. Socket data goes in and only the body comes out, with the chunk size
+// lines, extensions and trailers removed. Data is filtered in place, so no extra buffer is needed. When the
+// response isn't chunked, everything is passed through unchanged.
+//
+class httpChunkDecoder {
+    private:
+        bool chunked;
+        uint8_t state;
+        uint32_t chunkRemaining;    // Bytes of chunk data still to come
+        uint8_t sizeDigits;
+
+        int hexValue(char c);
+
+    public:
+        httpChunkDecoder();
+        void reset(bool isChunked);
+        size_t filter(char *buf, size_t len);
+        bool filter(char c);
+        bool isComplete();
+        bool isError();
+};
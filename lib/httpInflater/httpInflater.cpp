@@ -0,0 +1,230 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * HTTP Inflater Library - decompresses a gzip or deflate Content-Encoding response body as it's read.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <httpInflater.h>
+
+#define GZIP_FHCRC 0x02     // gzip header flags
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+
+httpInflater::httpInflater() {
+    reset(ENCODING_IDENTITY);
+}
+
+httpInflater::~httpInflater() {
+    end();
+}
+
+//
+// Allocates the inflate window and decompressor. Returns false if there isn't the memory, in which case the
+// client shouldn't ask for a compressed response.
+//
+bool httpInflater::begin() {
+    if (!window) window = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+    if (!decompressor) decompressor = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    if (window && decompressor) return true;
+    end();
+    return false;
+}
+
+void httpInflater::end() {
+    free(window);
+    free(decompressor);
+    window = nullptr;
+    decompressor = nullptr;
+}
+
+//
+// Start a new response body with the given Content-Encoding. Returns false if the body can't be decoded.
+//
+bool httpInflater::reset(uint8_t contentEncoding) {
+    encoding = contentEncoding;
+    state = (encoding == ENCODING_GZIP) ? INFLATE_HEADER : INFLATE_DATA;
+    fieldRemaining = GZIP_HEADER_SIZE;
+    tinflFlags = (encoding == ENCODING_DEFLATE) ? TINFL_FLAG_PARSE_ZLIB_HEADER : 0;
+    moreOutput = false;
+    windowPos = 0;
+    input = nullptr;
+    inputRemaining = 0;
+    bytesIn = 0;
+    bytesOut = 0;
+    if (encoding == ENCODING_IDENTITY) return true;
+    if (encoding == ENCODING_UNSUPPORTED || !window || !decompressor) {
+        state = INFLATE_ERROR;
+        return false;
+    }
+    tinfl_init(decompressor);
+    return true;
+}
+
+//
+// Maps a Content-Encoding header value to one of the ENCODING_ values
+//
+uint8_t httpInflater::parseEncoding(const String &headerValue) {
+    String value = headerValue;
+    value.trim();
+    value.toLowerCase();
+    if (value.length() == 0 || value == F("identity")) return ENCODING_IDENTITY;
+    if (value == F("gzip") || value == F("x-gzip")) return ENCODING_GZIP;
+    if (value == F("deflate")) return ENCODING_DEFLATE;
+    return ENCODING_UNSUPPORTED;
+}
+
+//
+// Body data to be decoded. The buffer must stay unchanged until read() has returned 0.
+//
+void httpInflater::write(const char *buf, size_t len) {
+    input = (const uint8_t *)buf;
+    inputRemaining = len;
+    bytesIn += len;
+}
+
+//
+// Moves on to the next optional field the gzip header flags say is present, or to the compressed data
+//
+void httpInflater::nextHeaderField() {
+    if (state < INFLATE_EXTRA_LEN && (flags & GZIP_FEXTRA)) {
+        state = INFLATE_EXTRA_LEN;
+        fieldRemaining = 2;
+    } else if (state < INFLATE_NAME && (flags & GZIP_FNAME)) {
+        state = INFLATE_NAME;
+    } else if (state < INFLATE_COMMENT && (flags & GZIP_FCOMMENT)) {
+        state = INFLATE_COMMENT;
+    } else if (state < INFLATE_HCRC && (flags & GZIP_FHCRC)) {
+        state = INFLATE_HCRC;
+        fieldRemaining = 2;
+    } else {
+        state = INFLATE_DATA;
+    }
+}
+
+void httpInflater::readHeader() {
+    while (inputRemaining && state < INFLATE_DATA) {
+        uint8_t c = *input++;
+        inputRemaining--;
+        switch (state) {
+            case INFLATE_HEADER:
+                header[GZIP_HEADER_SIZE - fieldRemaining] = c;
+                if (--fieldRemaining == 0) {
+                    // Magic number and the deflate compression method
+                    if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8) {
+                        state = INFLATE_ERROR;
+                        return;
+                    }
+                    flags = header[3];
+                    nextHeaderField();
+                }
+                break;
+
+            case INFLATE_EXTRA_LEN:
+                header[2 - fieldRemaining] = c;
+                if (--fieldRemaining == 0) {
+                    fieldRemaining = header[0] | (header[1] << 8);
+                    state = INFLATE_EXTRA;
+                    if (!fieldRemaining) nextHeaderField();
+                }
+                break;
+
+            case INFLATE_EXTRA:
+            case INFLATE_HCRC:
+                if (--fieldRemaining == 0) nextHeaderField();
+                break;
+
+            case INFLATE_NAME:
+            case INFLATE_COMMENT:
+                if (!c) nextHeaderField();      // Both are zero terminated
+                break;
+        }
+    }
+}
+
+//
+// The gzip trailer holds a CRC and the uncompressed length. Checking the length catches a body that inflated
+// without error but not to what was sent.
+//
+void httpInflater::readTrailer() {
+    while (inputRemaining && state == INFLATE_TRAILER) {
+        header[GZIP_TRAILER_SIZE - fieldRemaining] = *input++;
+        inputRemaining--;
+        if (--fieldRemaining == 0) {
+            uint32_t length = header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+            state = (length == bytesOut) ? INFLATE_DONE : INFLATE_ERROR;
+        }
+    }
+}
+
+//
+// Returns the next run of decoded body data in *out, or 0 once everything written so far has been used.
+// The data is only valid until the next call.
+//
+size_t httpInflater::read(char **out) {
+    if (encoding == ENCODING_IDENTITY) {
+        size_t len = inputRemaining;
+        *out = (char *)input;
+        inputRemaining = 0;
+        bytesOut += len;
+        return len;
+    }
+
+    if (state < INFLATE_DATA) readHeader();
+    while (state == INFLATE_DATA && (inputRemaining || moreOutput)) {
+        size_t inSize = inputRemaining;
+        size_t outSize = TINFL_LZ_DICT_SIZE - windowPos;
+        tinfl_status status = tinfl_decompress(decompressor, input, &inSize, window, window + windowPos, &outSize, tinflFlags | TINFL_FLAG_HAS_MORE_INPUT);
+        input += inSize;
+        inputRemaining -= inSize;
+        moreOutput = (status == TINFL_STATUS_HAS_MORE_OUTPUT);
+
+        if (status < TINFL_STATUS_DONE) {
+            state = INFLATE_ERROR;
+            return 0;
+        } else if (status == TINFL_STATUS_DONE) {
+            state = (encoding == ENCODING_GZIP) ? INFLATE_TRAILER : INFLATE_DONE;
+            fieldRemaining = GZIP_TRAILER_SIZE;
+        }
+
+        if (outSize) {
+            // The window wraps, so output is handed back in runs up to its end
+            *out = (char *)window + windowPos;
+            windowPos = (windowPos + outSize) & (TINFL_LZ_DICT_SIZE - 1);
+            bytesOut += outSize;
+            return outSize;
+        }
+        if (!inSize) break;
+    }
+    if (state == INFLATE_TRAILER) readTrailer();
+    return 0;
+}
+
+bool httpInflater::isCompressed() {
+    return encoding != ENCODING_IDENTITY;
+}
+
+//
+// True once the end of the compressed data has been reached. For a body that isn't compressed the inflater
+// can't tell where it ends, so this is always false.
+//
+bool httpInflater::isComplete() {
+    return encoding != ENCODING_IDENTITY && state == INFLATE_DONE;
+}
+
+bool httpInflater::isError() {
+    return state == INFLATE_ERROR;
+}
+
+uint32_t httpInflater::getBytesIn() {
+    return bytesIn;
+}
+
+uint32_t httpInflater::getBytesOut() {
+    return bytesOut;
+}
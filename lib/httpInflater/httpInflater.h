@@ -0,0 +1,89 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * HTTP Inflater Library - decompresses a gzip or deflate Content-Encoding response body as it's read.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+// The inflate code itself is the copy of miniz that's already in the ESP32 ROM, so costs no flash
+#if __has_include(<esp32/rom/miniz.h>)
+#include <esp32/rom/miniz.h>
+#elif __has_include(<rom/miniz.h>)
+#include <rom/miniz.h>
+#else
+#include <miniz.h>
+#endif
+
+#define ENCODING_IDENTITY 0     // Content-Encoding values
+#define ENCODING_GZIP 1
+#define ENCODING_DEFLATE 2     // zlib wrapped, as RFC 9110 says it should be
+#define ENCODING_UNSUPPORTED 3
+
+#define INFLATE_HEADER 0        // Reading the fixed part of the gzip header
+#define INFLATE_EXTRA_LEN 1     // Optional gzip header fields
+#define INFLATE_EXTRA 2
+#define INFLATE_NAME 3
+#define INFLATE_COMMENT 4
+#define INFLATE_HCRC 5
+#define INFLATE_DATA 6          // Inflating the compressed data
+#define INFLATE_TRAILER 7       // Reading the gzip CRC and length
+#define INFLATE_DONE 8
+#define INFLATE_ERROR 9
+
+#define GZIP_HEADER_SIZE 10
+#define GZIP_TRAILER_SIZE 8
+
+//
+// Sits between the chunk decoder and a parser. Compressed body data is written in and the inflated data read
+// back out in runs, straight from the 32KB inflate window, so the body is never held in memory whole:
+//
+//   inflater.write(buf, len);
+//   while ((n = inflater.read(&out)) > 0) parser.parse(out, n);
+//
+// The window and decompressor state (about 43KB) are only allocated between begin() and end(), so a client
+// should hold them for the duration of one request. When the body isn't compressed, data is passed through.
+//
+class httpInflater {
+    private:
+        tinfl_decompressor *decompressor = nullptr;
+        uint8_t *window = nullptr;
+        size_t windowPos;
+        uint8_t encoding;
+        uint8_t state;
+        uint8_t flags;              // gzip header flags
+        uint8_t header[GZIP_HEADER_SIZE];
+        uint16_t fieldRemaining;    // Bytes left in the current header or trailer field
+        uint32_t tinflFlags;
+        bool moreOutput;            // The window filled before the last input was used up
+        const uint8_t *input;       // Compressed data written but not yet inflated
+        size_t inputRemaining;
+        uint32_t bytesIn;
+        uint32_t bytesOut;
+
+        void nextHeaderField();
+        void readHeader();
+        void readTrailer();
+
+    public:
+        httpInflater();
+        ~httpInflater();
+        bool begin();
+        void end();
+        bool reset(uint8_t contentEncoding);
+        void write(const char *buf, size_t len);
+        size_t read(char **out);
+        bool isCompressed();
+        bool isComplete();
+        bool isError();
+        uint32_t getBytesIn();
+        uint32_t getBytesOut();
+
+        static uint8_t parseEncoding(const String &headerValue);
+};
@@ -0,0 +1,78 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Poll Scheduler Library - works out how long to wait before the next board update.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <pollScheduler.h>
+
+pollScheduler::pollScheduler(unsigned long baseInterval, unsigned long minInterval, unsigned long maxInterval, bool hurryWhenDue) {
+    this->baseInterval = baseInterval;
+    this->hurryWhenDue = hurryWhenDue;
+    setLimits(minInterval,maxInterval);
+}
+
+void pollScheduler::setLimits(unsigned long minInterval, unsigned long maxInterval) {
+    if (maxInterval < minInterval) maxInterval = minInterval;
+    this->minInterval = minInterval;
+    this->maxInterval = maxInterval;
+}
+
+// Forget the change history, e.g. when the station has changed
+void pollScheduler::reset() {
+    unchanged = 0;
+}
+
+//
+// Returns the time (ms) to wait after a successful poll. changed is whether it found anything different,
+// minutesToFirst is how long until the first service goes (-1 if there are none), disrupted is whether there
+// are any messages about disruption, and hour is the local hour of the day (-1 if the clock isn't set).
+//
+unsigned long pollScheduler::nextInterval(bool changed, int minutesToFirst, bool disrupted, int hour) {
+    if (changed) unchanged = 0;
+    else if (unchanged < POLLSTREAKMAX) unchanged++;
+
+    // The longer the board stays the same the less often it's looked at, up to twice as long
+    unsigned long interval = baseInterval;
+    if (unchanged > POLLSTREAKSTART) interval += baseInterval * (unchanged - POLLSTREAKSTART) / (POLLSTREAKMAX - POLLSTREAKSTART);
+
+    // Nothing going for a while
+    if (minutesToFirst < 0 || minutesToFirst >= POLLDISTANTMINS) interval *= 2;
+
+    // Disruption messages come and go, so keep to the usual rate
+    if (disrupted && interval > baseInterval) interval = baseInterval;
+
+    if (hour >= POLLQUIETSTARTS && hour < POLLQUIETENDS) interval = maxInterval;
+
+    // The first service is about to go. Keep up with it, more so if its details are still changing (unless
+    // hurryWhenDue is off, as for TfL, whose arrival times change on every poll).
+    if (minutesToFirst >= 0 && minutesToFirst <= POLLSOONMINS) {
+        if (changed && hurryWhenDue) interval = baseInterval * 2 / 3;
+        else if (interval > baseInterval) interval = baseInterval;
+    }
+
+    if (interval < minInterval) interval = minInterval;
+    if (interval > maxInterval) interval = maxInterval;
+    return interval;
+}
+
+int pollScheduler::getUnchanged() {
+    return unchanged;
+}
+
+//
+// Minutes from the given time of day until a time in the form hh:mm, allowing for midnight either way. 0 if it's
+// already gone, -1 if it isn't a time.
+//
+int pollScheduler::minutesUntil(const char *hhmm, int hour, int minute) {
+    if (strlen(hhmm) < 5 || hhmm[2] != ':') return -1;
+    int minutes = atoi(hhmm)*60 + atoi(hhmm+3) - (hour*60 + minute);
+    if (minutes < -720) minutes += 1440;    // Past midnight
+    else if (minutes > 720) minutes -= 1440;
+    return (minutes < 0) ? 0 : minutes;
+}
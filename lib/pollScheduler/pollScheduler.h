@@ -0,0 +1,41 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Poll Scheduler Library - works out how long to wait before the next board update.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define POLLSOONMINS 5          // A first departure this close is polled more often
+#define POLLDISTANTMINS 30      // If there's nothing before this the board can be polled less often
+#define POLLSTREAKSTART 2       // Unchanged polls in a row before the interval starts to stretch
+#define POLLSTREAKMAX 6         // Unchanged polls after which it stops stretching (at twice the base interval)
+#define POLLQUIETSTARTS 1       // Hours of the night when few services run, polled at the longest interval
+#define POLLQUIETENDS 5
+
+//
+// Picks the interval to the next poll from what the last one found, between a minimum and maximum. There's no
+// clock in here, everything it goes on is passed in, so it can be run against a simulated one.
+//
+class pollScheduler {
+    private:
+        unsigned long baseInterval;     // ms
+        unsigned long minInterval;
+        unsigned long maxInterval;
+        int unchanged = 0;              // Polls in a row that found no change
+        bool hurryWhenDue;              // Poll faster than the base interval while the first service is about to go
+
+    public:
+        pollScheduler(unsigned long baseInterval, unsigned long minInterval, unsigned long maxInterval, bool hurryWhenDue = true);
+        void setLimits(unsigned long minInterval, unsigned long maxInterval);
+        void reset();
+        unsigned long nextInterval(bool changed, int minutesToFirst, bool disrupted, int hour);
+        int getUnchanged();
+        static int minutesUntil(const char *hhmm, int hour, int minute);
+};
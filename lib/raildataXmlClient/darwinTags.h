@@ -0,0 +1,84 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * raildataXmlClient Library - Darwin element names
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+
+//
+// The namespaces that raildataXmlClient recognises. Darwin assigns its prefixes (lt4:, lt5:...) per schema
+// version, so the XML parser resolves each element's prefix through the xmlns declarations in scope and
+// reports the namespace as an id instead. A trailing '*' matches any URI with that start, so every versioned
+// RTTI namespace maps to NS_DARWIN. Any other namespace is reported as XML_NS_UNKNOWN.
+//
+#define DARWIN_NAMESPACES(X) \
+    X(NS_DARWIN,                  "http://thalesgroup.com/RTTI/*") \
+    X(NS_SOAP_ENVELOPE,           "http://schemas.xmlsoap.org/soap/envelope/") \
+    X(NS_WSDL,                    "http://schemas.xmlsoap.org/wsdl/") \
+    X(NS_WSDL_SOAP,               "http://schemas.xmlsoap.org/wsdl/soap/")
+
+//
+// The element local names (without prefix) that raildataXmlClient acts on. The XML parser interns each tag
+// name against this table (by binary search) and hands the listener the resulting ids, so the list MUST be
+// kept in strcmp() order (a static_assert in raildataXmlClient.cpp fails the build if it isn't). Any element
+// not listed here is reported as XML_TAG_UNKNOWN.
+//
+#define DARWIN_TAGS(X) \
+    X(TAG_GETSTATIONBOARDRESULT,  "GetStationBoardResult") \
+    X(TAG_ADDRESS,                "address") \
+    X(TAG_BUSSERVICES,            "busServices") \
+    X(TAG_CALLINGPOINT,           "callingPoint") \
+    X(TAG_CANCELREASON,           "cancelReason") \
+    X(TAG_COACHCLASS,             "coachClass") \
+    X(TAG_DEFINITIONS,            "definitions") \
+    X(TAG_DELAYREASON,            "delayReason") \
+    X(TAG_DESTINATION,            "destination") \
+    X(TAG_ETA,                    "eta") \
+    X(TAG_ETD,                    "etd") \
+    X(TAG_FORMATION,              "formation") \
+    X(TAG_GENERATEDAT,            "generatedAt") \
+    X(TAG_LENGTH,                 "length") \
+    X(TAG_LOCATION,               "location") \
+    X(TAG_LOCATIONNAME,           "locationName") \
+    X(TAG_MESSAGE,                "message") \
+    X(TAG_NRCCMESSAGES,           "nrccMessages") \
+    X(TAG_OPERATOR,               "operator") \
+    X(TAG_ORIGIN,                 "origin") \
+    X(TAG_PLATFORM,               "platform") \
+    X(TAG_PLATFORMAVAILABLE,      "platformAvailable") \
+    X(TAG_PREVIOUSCALLINGPOINTS,  "previousCallingPoints") \
+    X(TAG_SERVICE,                "service") \
+    X(TAG_SERVICEID,              "serviceID") \
+    X(TAG_SERVICETYPE,            "serviceType") \
+    X(TAG_ST,                     "st") \
+    X(TAG_STA,                    "sta") \
+    X(TAG_STD,                    "std") \
+    X(TAG_SUBSEQUENTCALLINGPOINTS,"subsequentCallingPoints") \
+    X(TAG_TRAINSERVICES,          "trainServices") \
+    X(TAG_VIA,                    "via")
+
+#define DARWIN_TAG_ENUM(id, name) id,
+#define DARWIN_TAG_NAME(id, name) name,
+
+// Tag ids start at 1, 0 is XML_TAG_UNKNOWN
+enum darwinTag : uint8_t {
+    TAG_DARWIN_NONE = 0,
+    DARWIN_TAGS(DARWIN_TAG_ENUM)
+    TAG_DARWIN_END
+};
+
+// Namespace ids start at 1, 0 is XML_NS_UNKNOWN
+enum darwinNamespace : uint8_t {
+    NS_DARWIN_NONE = 0,
+    DARWIN_NAMESPACES(DARWIN_TAG_ENUM)
+    NS_DARWIN_END
+};
+
+#define DARWIN_TAG_COUNT (TAG_DARWIN_END - 1)
+#define DARWIN_NS_COUNT (NS_DARWIN_END - 1)
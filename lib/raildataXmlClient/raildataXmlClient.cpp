@@ -12,43 +12,96 @@
 #include <raildataXmlClient.h>
 #include <xmlListener.h>
 #include <WiFiClientSecure.h>
+#include <LittleFS.h>
+#include <time.h>
 #include <stationData.h>
+#include <requestBudget.h>
 
-raildataXmlClient::raildataXmlClient() {
+// Element names interned by the XML parser, indexed by darwinTag-1
+static constexpr const char *darwinTagNames[DARWIN_TAG_COUNT] PROGMEM = {
+    DARWIN_TAGS(DARWIN_TAG_NAME)
+};
+static_assert(xmlTableSorted(darwinTagNames, DARWIN_TAG_COUNT), "DARWIN_TAGS must be kept in strcmp() order");
+
+// Namespace URI prefixes resolved by the XML parser, indexed by darwinNamespace-1
+static const char * const darwinNamespaceURIs[DARWIN_NS_COUNT] PROGMEM = {
+    DARWIN_NAMESPACES(DARWIN_TAG_NAME)
+};
+
+// Unwanted text at the end of station messages, which is cut off from the first of these
+static const char * const stationMessageEnds[] = {
+    " More details ",
+    " Latest information ",
+    " Further information "
+};
+
+raildataXmlClient::raildataXmlClient() :
+    fieldText(TEXT_MARKUP),
+    messageText(TEXT_MESSAGE),
+    stationMessageText(TEXT_MESSAGE,stationMessageEnds,sizeof(stationMessageEnds)/sizeof(stationMessageEnds[0])) {
     firstDataLoad=true;
+    strcpy(ldbNamespace,DEFAULTLDBNAMESPACE);
+    strcpy(detailCrs,"");
+    soapClient.setInsecure();
+    soapClient.setTimeout(15000);
+    soapClient.setNoDelay(false);
 }
 
-// Custom comparator function to compare time strings
+// Custom comparator function to compare services by time (the keys already allow for midnight)
 bool raildataXmlClient::compareTimes(const rdiService& a, const rdiService& b) {
-    // Convert time strings to integers for comparison
-    int hour1, minute1, hour2, minute2;
-    sscanf(a.sTime, "%d:%d", &hour1, &minute1);
-    sscanf(b.sTime, "%d:%d", &hour2, &minute2);
+    return a.sortKey < b.sortKey;
+}
 
-    // Compare hours first
-    if (hour1 != hour2) {
-        // Fudge for rollover at midnight
-        if (hour1 < 2 && hour2 > 20) return false;
-        if (hour2 < 2 && hour1 > 20) return true;
-        else return hour1 < hour2;
-    }
-    // If hours are equal, compare minutes
-    return minute1 < minute2;
+//
+// Converts a time of day in the form hh:mm to minutes since midnight, -1 if it isn't one
+//
+int raildataXmlClient::timeMinutes(const char *hhmm) {
+    if (!isDigit(hhmm[0]) || !isDigit(hhmm[1]) || hhmm[2] != ':' || !isDigit(hhmm[3]) || !isDigit(hhmm[4])) return -1;
+    return ((hhmm[0]-'0')*10 + hhmm[1]-'0') * 60 + (hhmm[3]-'0')*10 + hhmm[4]-'0';
 }
 
 //
-// This function obtains the SOAP host and api url from the given wsdlHost and wsdlAPI
+// Sort key for a service's time, the minutes from when the board was generated. Darwin's times and generatedAt
+// are both local, so a change between GMT and BST is already allowed for. A board runs from a little before it
+// was generated to a few hours after, so a time more than 6 hours earlier must be after midnight, and one more
+// than 18 hours later must be before it.
+//
+int raildataXmlClient::serviceKey(const char *hhmm) {
+    int minutes = timeMinutes(hhmm);
+    if (minutes < 0) return 0;
+    if (boardMinutes < 0) boardMinutes = minutes;
+    int key = minutes - boardMinutes;
+    if (key < -360) key += 1440;
+    else if (key >= 1080) key -= 1440;
+    return key;
+}
+
+//
+// This function obtains the SOAP host, api url and request namespace from the given wsdlHost and wsdlAPI.
+// They're taken from the cache if this WSDL has been loaded before, otherwise the WSDL is downloaded.
 //
 int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallback RDcb)
 {
     Xcb = RDcb;
+    strlcpy(wsdlHostName,wsdlHost,sizeof(wsdlHostName));
+    strlcpy(wsdlApiUrl,wsdlAPI,sizeof(wsdlApiUrl));
+
+    if (loadCachedEndpoint()) return UPD_SUCCESS;
+    return loadWsdl();
+}
 
+//
+// Downloads the WSDL and extracts the SOAP host, api url and request namespace from it. If successful, they're
+// saved to the cache.
+//
+int raildataXmlClient::loadWsdl()
+{
     WiFiClientSecure httpsClient;
     httpsClient.setInsecure();
     httpsClient.setTimeout(15000);
 
     int retryCounter=0; //retry counter
-    while((!httpsClient.connect(wsdlHost, 443)) && (retryCounter < 30)){
+    while((!httpsClient.connect(wsdlHostName, 443)) && (retryCounter < 30)){
         delay(100);
         retryCounter++;
     }
@@ -56,8 +109,8 @@ int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallbac
       return UPD_NO_RESPONSE;   // No response within 3s
     }
 
-    httpsClient.print("GET " + String(wsdlAPI) + F(" HTTP/1.0\r\n") +
-      F("Host: ") + String(wsdlHost) + F("\r\n") +
+    httpsClient.print("GET " + String(wsdlApiUrl) + F(" HTTP/1.0\r\n") +
+      F("Host: ") + String(wsdlHostName) + F("\r\n") +
       F("Connection: close\r\n\r\n"));
 
     retryCounter = 0;
@@ -69,6 +122,7 @@ int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallbac
         }
     }
 
+    bool bChunked = false;
     while (httpsClient.connected() || httpsClient.available()) {
       String line = httpsClient.readStringUntil('\n');
       // check for success code...
@@ -83,191 +137,247 @@ int raildataXmlClient::init(const char *wsdlHost, const char *wsdlAPI, rdCallbac
             return UPD_HTTP_ERROR;
           }
         }
-      }
+      } else if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
       if (line == F("\r")) {
         // Headers received
         break;
       }
     }
 
-    char c;
     unsigned long dataSendTimeout = millis() + 8000UL;
+    char previousNamespace[MAXNAMESPACESIZE];
+    strcpy(previousNamespace,ldbNamespace);     // Kept in case the download fails
     loadingWDSL = true;
-    xmlStreamingParser parser;
+    foundSoapAddress = false;
+    strcpy(ldbNamespace,DEFAULTLDBNAMESPACE);
+    BasicXmlParser<raildataXmlClient> parser;
     parser.setListener(this);
+    parser.setTagTable(darwinTagNames, DARWIN_TAG_COUNT);
+    parser.setNamespaceTable(darwinNamespaceURIs, DARWIN_NS_COUNT);
     parser.reset();
-    grandParentTagName = "";
-    parentTagName = "";
-    tagName = "";
-    tagLevel = 0;
+    valueContinues = false;
+    dechunker.reset(bChunked);
 
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
       while (httpsClient.available()) {
-        c = httpsClient.read();
-        parser.parse(c);
+        int bytesRead = httpsClient.read((uint8_t *)readBuffer, sizeof(readBuffer));
+        if (bytesRead <= 0) break;
+        parser.parse(readBuffer, dechunker.filter(readBuffer, bytesRead));
       }
     }
 
     httpsClient.stop();
     loadingWDSL = false;
 
-    if (soapURL.startsWith(F("https://"))) {
-      int delim = soapURL.indexOf(F("/"),8);
-      if (delim>0) {
-        soapURL.substring(8,delim).toCharArray(soapHost,sizeof(soapHost));
-        soapURL.substring(delim).toCharArray(soapAPI,sizeof(soapAPI));
+    if (foundSoapAddress) {
+        soapClient.stop();      // Any open connection may be to the old endpoint
+        endpointCached = false;
+        endpointStale = false;
+        saveCachedEndpoint();
         return UPD_SUCCESS;
-      }
     }
+    strcpy(ldbNamespace,previousNamespace);
     return UPD_DATA_ERROR;
 }
 
 //
-// Function to remove HTML tags from a character array
+// Loads the SOAP endpoint saved by a previous WSDL download, if it came from the same WSDL. An endpoint older
+// than WSDLCACHETTL is still used, but marked for checking against the WSDL once the board is up.
 //
-void raildataXmlClient::removeHtmlTags(char* input) {
-    bool inTag = false;
-    char* output = input; // Output pointer
+bool raildataXmlClient::loadCachedEndpoint() {
+    File file = LittleFS.open(F(WSDLCACHEFILE), "r");
+    if (!file) return false;
 
-    for (char* p = input; *p; ++p) {
-        if (*p == '<') {
-            inTag = true;
-        } else if (*p == '>') {
-            inTag = false;
-        } else if (!inTag) {
-            *output++ = *p; // Copy non-tag characters
-        }
-    }
+    String wsdlUrl = file.readStringUntil('\n');
+    String host = file.readStringUntil('\n');
+    String api = file.readStringUntil('\n');
+    String ns = file.readStringUntil('\n');
+    long savedTime = file.readStringUntil('\n').toInt();
+    file.close();
 
-    *output = '\0'; // Null-terminate the output
+    if (wsdlUrl != String(wsdlHostName) + String(wsdlApiUrl)) return false;   // A different WSDL
+    if (!host.length() || host.length() >= sizeof(soapHost) || !api.length() || api.length() >= sizeof(soapAPI) || !ns.length() || ns.length() >= sizeof(ldbNamespace)) return false;
+
+    strcpy(soapHost,host.c_str());
+    strcpy(soapAPI,api.c_str());
+    strcpy(ldbNamespace,ns.c_str());
+    endpointCached = true;
+    time_t now = time(nullptr);
+    endpointStale = (savedTime <= 0 || now - savedTime > WSDLCACHETTL || now < savedTime);
+    return true;
 }
 
 //
-// Function to replace occurrences of a word or phrase in a character array
+// Saves the SOAP endpoint from the WSDL, keyed by the WSDL url
 //
-void raildataXmlClient::replaceWord(char* input, const char* target, const char* replacement) {
-    // Find the first occurrence of the target word
-    char* pos = strstr(input, target);
-    while (pos) {
-        // Calculate the length of the target word
-        size_t targetLen = strlen(target);
-        // Calculate the length difference between target and replacement
-        int diff = strlen(replacement) - targetLen;
-
-        // Shift the remaining characters to accommodate the replacement
-        memmove(pos + strlen(replacement), pos + targetLen, strlen(pos + targetLen) + 1);
-
-        // Copy the replacement word into the position
-        memcpy(pos, replacement, strlen(replacement));
-
-        // Find the next occurrence of the target word
-        pos = strstr(pos + strlen(replacement), target);
-    }
+void raildataXmlClient::saveCachedEndpoint() {
+    File file = LittleFS.open(F(WSDLCACHEFILE), "w");
+    if (!file) return;
+    file.print(String(wsdlHostName) + String(wsdlApiUrl) + "\n" + String(soapHost) + "\n" + String(soapAPI) + "\n" + String(ldbNamespace) + "\n" + String((long)time(nullptr)) + "\n");
+    file.close();
 }
 
 //
-// Function to prune messages from the point at which a word or phrase is found
+// Tidies a text field in place. The XML parser has already decoded character references, so what's left is any
+// HTML markup within the text.
 //
-void raildataXmlClient::pruneFromPhrase(char* input, const char* target) {
-    // Find the first occurance of the target word or phrase
-    char* pos = strstr(input,target);
-    // If found, prune from here
-    if (pos) input[pos - input] = '\0';
+void raildataXmlClient::normalise(textRef &ref, textNormaliser &normaliser) {
+    if (!ref.length) return;
+    normaliser.normalise(arena.edit(ref));
+    arena.trim(ref);
 }
 
 //
-// Function to ensure there's one and only one fullstop at the end of messages.
+// Tidies a message once all of its text has been read, in a single pass that also cuts off any unwanted text at
+// the end of station messages and the trailing fullstops. It's still the top text in the arena at this point,
+// so it can be shortened and the one fullstop added without leaving a gap.
 //
-void raildataXmlClient::fixFullStop(char *input) {
-    if (input[0]) {
-        while (input[0] && (input[strlen(input)-1] == '.' || input[strlen(input)-1] == ' ')) input[strlen(input)-1] = '\0'; // Remove all trailing full stops
-        if (strlen(input) < MAXMESSAGESIZE-1) strcat(input,".");  // Add a single fullstop
-    }
+void raildataXmlClient::finishMessage(textRef &ref, bool isStationMessage) {
+    normalise(ref, isStationMessage ? stationMessageText : messageText);
+    if (ref.length && ref.length < MAXMESSAGESIZE-1) arena.append(ref,".",1,MAXMESSAGESIZE-1);
 }
 
 //
-// Updates the Departure Board data from the SOAP API
+// Updates the Departure Board data from the SOAP API. If the endpoint came from the cache and the request fails,
+// the WSDL is downloaded again in case the endpoint has moved, and the request retried if that works. An old
+// cached endpoint is left for the caller to check with refreshEndpoint(), so the board isn't held up by it.
+//
+// Calling points and formation are only shown for the first service, so most polls ask for the board alone
+// (GetDepartureBoard) and fill them in from the details cached by service ID. The details are requested when
+// the first service isn't in the cache, and every DETAILREFRESHINTERVAL.
+//
+// With includeArrivals the board comes from GetArrDepBoardWithDetails (or GetArrivalDepartureBoard), so the
+// services arriving here are in the same single response as those departing, with their sta and eta filled in.
+// Each poll is then a single request (more only when a filtered board pages through time windows): a first
+// service that isn't in the cache has its details fetched by the next poll instead of straight away.
 //
-int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode) {
+int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, bool includeArrivals) {
+    arrivals = includeArrivals;
+    if (arrivals != lastArrivals) {
+        // The details cached came from the other kind of board
+        detailsValid = false;
+        lastArrivals = arrivals;
+    }
 
-    unsigned long perfTimer=millis();
-    bool bChunked = false;
-    lastErrorMessage = "";
+    bool withDetails = !detailsValid || strcmp(detailCrs,crsCode) || (millis() - lastDetailPoll >= DETAILREFRESHINTERVAL);
+    int result = requestDepartures(station,messages,crsCode,customToken,numRows,includeBusServices,callingCrsCode,withDetails);
+    if (result == UPD_NEED_DETAILS) result = requestDepartures(station,messages,crsCode,customToken,numRows,includeBusServices,callingCrsCode,true);
+    if (endpointCached && (result == UPD_NO_RESPONSE || result == UPD_HTTP_ERROR || result == UPD_DATA_ERROR)) {
+        String requestError = lastErrorMessage;
+        if (loadWsdl() == UPD_SUCCESS) {
+            result = requestDepartures(station,messages,crsCode,customToken,numRows,includeBusServices,callingCrsCode,true);
+        } else {
+            lastErrorMessage = requestError;
+        }
+    }
+    return result;
+}
 
-    // Reset the counters
-    xStation.numServices=0;
-    xMessages.numMessages=0;
-    xStation.platformAvailable=false;
-    addedStopLocation = false;
-    strcpy(xStation.location,"");
+bool raildataXmlClient::isEndpointStale() {
+    return endpointStale;
+}
 
-    for (int i=0;i<MAXBOARDSERVICES;i++) {
-      strcpy(xStation.service[i].sTime,"");
-      strcpy(xStation.service[i].destination,"");
-      strcpy(xStation.service[i].via,"");
-      strcpy(xStation.service[i].origin,"");
-      strcpy(xStation.service[i].etd,"");
-      strcpy(xStation.service[i].platform,"");
-      strcpy(xStation.service[i].opco,"");
-      strcpy(xStation.service[i].calling,"");
-      strcpy(xStation.service[i].serviceMessage,"");
-      xStation.service[i].trainLength=0;
-      xStation.service[i].classesAvailable=0;
-      xStation.service[i].serviceType=0;
-      xStation.service[i].isCancelled=false;
-      xStation.service[i].isDelayed=false;
-    }
-    for (int i=0;i<MAXBOARDMESSAGES;i++) strcpy(xMessages.messages[i],"");
-    id=-1;
-    coaches=0;
+//
+// Checks an old cached endpoint against the WSDL, downloading it again. This takes as long as a board update, so
+// it's left to the caller to run when nothing else is due.
+//
+int raildataXmlClient::refreshEndpoint() {
+    if (!endpointStale) return UPD_SUCCESS;
+    endpointStale = false;      // Don't try again until next time if the WSDL can't be loaded
+    String updateResult = lastErrorMessage;
+    int result = loadWsdl();
+    lastErrorMessage = updateResult;
+    return result;
+}
 
-    WiFiClientSecure httpsClient;
-    httpsClient.setInsecure();
-    httpsClient.setTimeout(15000);
-    httpsClient.setNoDelay(false);
+//
+// Sends one request for the board and reads the services in the response into xStation, after any already there.
+// A filtered board is read in pages covering successive time windows, which is what timeOffset is for.
+//
+int raildataXmlClient::requestPage(const char *crsCode, const char *customToken, int numRows, bool withDetails, int timeOffset) {
 
-    int retryCounter=0; //retry counter
-    while((!httpsClient.connect(soapHost, 443)) && (retryCounter < 30)) {
-        delay(100);
-        retryCounter++;
+    bool bChunked = false;
+    uint8_t contentEncoding = ENCODING_IDENTITY;
+    httpInflater inflater;      // The inflate window is only held for the duration of the request
+
+    if (!apiBudget.acquire(UPSTREAM_DARWIN)) {
+        lastErrorMessage = "Request budget used up, next request allowed in " + String(apiBudget.getWait(UPSTREAM_DARWIN) / 1000) + F("s");
+        return UPD_THROTTLED;
     }
-    if(retryCounter>=30) {
-        lastErrorMessage = F("Timed out, no response from connect");    // No response within 3s
-        return UPD_NO_RESPONSE;
+
+    // Reuse the connection from the last poll if the server has kept it open
+    bool reused = soapClient.connected();
+    if (!reused) {
+        soapClient.stop();
+        if (!connectSoapHost()) {
+            lastErrorMessage = F("Timed out, no response from connect");    // No response within 3s
+            return UPD_NO_RESPONSE;
+        }
     }
 
-    int reqRows = MAXBOARDSERVICES;
-    if (callingCrsCode[0]) reqRows = 10;   // Request maximum services if we're filtering
+    String requestType;
+    if (arrivals) requestType = withDetails ? F("GetArrDepBoardWithDetailsRequest") : F("GetArrivalDepartureBoardRequest");
+    else requestType = withDetails ? F("GetDepBoardWithDetailsRequest") : F("GetDepartureBoardRequest");
     String data = F("<soap-env:Envelope xmlns:soap-env=\"http://schemas.xmlsoap.org/soap/envelope/\"><soap-env:Header><ns0:AccessToken xmlns:ns0=\"http://thalesgroup.com/RTTI/2013-11-28/Token/types\"><ns0:TokenValue>");
-    data += String(customToken) + F("</ns0:TokenValue></ns0:AccessToken></soap-env:Header><soap-env:Body><ns0:GetDepBoardWithDetailsRequest xmlns:ns0=\"http://thalesgroup.com/RTTI/2021-11-01/ldb/\"><ns0:numRows>") + String(reqRows) + F("</ns0:numRows><ns0:crs>");
-    data += String(crsCode) + F("</ns0:crs></ns0:GetDepBoardWithDetailsRequest></soap-env:Body></soap-env:Envelope>");
+    data += String(customToken) + F("</ns0:TokenValue></ns0:AccessToken></soap-env:Header><soap-env:Body><ns0:") + requestType + F(" xmlns:ns0=\"") + String(ldbNamespace) + F("\"><ns0:numRows>") + String(numRows) + F("</ns0:numRows><ns0:crs>");
+    data += String(crsCode) + F("</ns0:crs>");
+    if (filter) {
+        data += "<ns0:filterCrs>" + String(filterCrs) + F("</ns0:filterCrs><ns0:filterType>to</ns0:filterType>");
+        if (timeOffset) data += "<ns0:timeOffset>" + String(timeOffset) + F("</ns0:timeOffset>");
+        data += "<ns0:timeWindow>" + String(FILTERTIMEWINDOW) + F("</ns0:timeWindow>");
+    }
+    data += "</ns0:" + requestType + F("></soap-env:Body></soap-env:Envelope>");
 
-    httpsClient.print("POST " + String(soapAPI) + F(" HTTP/1.1\r\n") +
+    String request = "POST " + String(soapAPI) + F(" HTTP/1.1\r\n") +
       F("Host: ") + String(soapHost) + F("\r\n") +
       F("Content-Type: text/xml;charset=UTF-8\r\n") +
-      F("Connection: close\r\n") +
-      F("Content-Length: ") + String(data.length()) + F("\r\n\r\n") +
-      data + F("\r\n\r\n"));
+      F("Connection: keep-alive\r\n");
+    if (inflater.begin()) request += F("Accept-Encoding: gzip\r\n");     // Only if there's the memory to inflate it
+    request += "Content-Length: " + String(data.length()) + F("\r\n\r\n") + data;
 
     Xcb(1,0);   // progress callback
     unsigned long ticker = millis()+800;
-    retryCounter = 0;
-    while(!httpsClient.available()) {
-        delay(100);
-        retryCounter++;
-        if (retryCounter >= 30) {
-            lastErrorMessage = F("Timed out (GET)");
-            return UPD_TIMEOUT;     // No response within 3s
+    int retryCounter;
+    while (true) {
+        soapRequests++;
+        soapClient.print(request);
+        retryCounter = 0;
+        while(!soapClient.available() && soapClient.connected() && retryCounter < 30) {
+            delay(100);
+            retryCounter++;
+        }
+        if (soapClient.available()) break;
+        if (reused) {
+            // The server closed the kept connection while we weren't looking, so connect again and resend
+            reused = false;
+            soapClient.stop();
+            if (!connectSoapHost()) {
+                lastErrorMessage = F("Timed out, no response from connect");
+                return UPD_NO_RESPONSE;
+            }
+            continue;
         }
+        soapClient.stop();
+        lastErrorMessage = F("Timed out (GET)");
+        return UPD_TIMEOUT;     // No response within 3s
     }
+    if (reused) soapReused++;
 
+    long contentLength = -1;    // Body length if the server gave one, otherwise we can't tell where the response ends
+    bool keepAlive = true;      // HTTP/1.1 connections persist unless the server says otherwise
     unsigned long dataSendTimeout = millis() + 1000UL;
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
-        String line = httpsClient.readStringUntil('\n');
+    while((soapClient.available() || soapClient.connected()) && (millis() < dataSendTimeout)) {
+        String line = soapClient.readStringUntil('\n');
         // check for success code...
         if (line.startsWith(F("HTTP"))) {
             if (line.indexOf(F("200 OK")) == -1) {
-                httpsClient.stop();
+                if (line.indexOf(F(" 429")) > 0) {
+                    apiBudget.rateLimited(UPSTREAM_DARWIN,requestBudget::readRetryAfter(soapClient));
+                    soapClient.stop();
+                    lastErrorMessage = line;
+                    return UPD_THROTTLED;
+                }
+                soapClient.stop();
                 if (line.indexOf(F("401")) > 0) {
                     lastErrorMessage = line;
                     return UPD_UNAUTHORISED;
@@ -279,7 +389,11 @@ int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *message
                     return UPD_HTTP_ERROR;
                 }
             }
+            apiBudget.succeeded(UPSTREAM_DARWIN);
         } else if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+        else if (line.startsWith(F("Content-Length:"))) contentLength = line.substring(15).toInt();
+        else if (line.startsWith(F("Content-Encoding:"))) contentEncoding = httpInflater::parseEncoding(line.substring(17));
+        else if (line.startsWith(F("Connection:")) && line.indexOf(F("close")) >= 0) keepAlive=false;
         if (line == F("\r")) {
             // Headers received
             break;
@@ -287,59 +401,148 @@ int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *message
         yield();
     }
 
-    xmlStreamingParser parser;
+    if (!inflater.reset(contentEncoding)) {
+        soapClient.stop();
+        lastErrorMessage = F("Unsupported Content-Encoding");
+        return UPD_DATA_ERROR;
+    }
+
+    BasicXmlParser<raildataXmlClient> parser;
     parser.setListener(this);
+    parser.setTagTable(darwinTagNames, DARWIN_TAG_COUNT);
+    parser.setNamespaceTable(darwinNamespaceURIs, DARWIN_NS_COUNT);
     parser.reset();
-    grandParentTagName = "";
-    parentTagName = "";
-    tagName = "";
-    tagLevel = 0;
+    valueContinues = false;
     loadingWDSL=false;
     long dataReceived = 0;
-    if (callingCrsCode[0]) {
-        strcpy(filterCrs,callingCrsCode);
-        filter=true;
-    } else {
-        strcpy(filterCrs,"");
-        filter=false;
-    }
-    keepRoute=false;
 
-    char c;
+    long bodyRemaining = bChunked ? -1 : contentLength;    // A chunked body's length comes from the chunks
+    bool bodyEnded = (bodyRemaining == 0);
+    bool drain = keepAlive && (bChunked || contentLength >= 0);  // Read the body to its end, even once the parser has stopped, to keep the connection
+    dechunker.reset(bChunked);
+    if (capture) capture->start("darwin",contentEncoding != ENCODING_IDENTITY);
     dataSendTimeout = millis() + 12000UL;
-    perfTimer=millis(); // Reset the data load timer
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
-        while (httpsClient.available()) {
-            c = httpsClient.read();
-            parser.parse(c);
-            dataReceived++;
+    while((soapClient.available() || soapClient.connected()) && (millis() < dataSendTimeout) && !bodyEnded) {
+        while (soapClient.available() && !bodyEnded && (drain || !parser.isStopped())) {
+            size_t readSize = sizeof(readBuffer);
+            if (bodyRemaining > 0 && bodyRemaining < (long)readSize) readSize = bodyRemaining;     // Don't read past the end of the response
+            int bytesRead = soapClient.read((uint8_t *)readBuffer, readSize);
+            if (bytesRead <= 0) break;
+            dataReceived += bytesRead;
+            if (bodyRemaining > 0) bodyRemaining -= bytesRead;
+            size_t bodyBytes = dechunker.filter(readBuffer, bytesRead);
+            if (capture) capture->write(readBuffer, bodyBytes);
+            // Once the parser has stopped the rest of the body is just drained, so the connection can be reused
+            if (!parser.isStopped()) {
+                inflater.write(readBuffer, bodyBytes);
+                char *xml;
+                size_t xmlBytes;
+                while (!parser.isStopped() && (xmlBytes = inflater.read(&xml)) > 0) parser.parse(xml, xmlBytes);
+            }
+            bodyEnded = bChunked ? (dechunker.isComplete() || dechunker.isError()) : (bodyRemaining == 0);
             if (millis()>ticker) {
                 Xcb(2,xStation.numServices);    // Callback progress
                 ticker = millis()+800;
             }
 //            yield();
         }
+        // Unless the connection is being kept, stop as soon as we have everything we need
+        if (!drain && parser.isStopped()) break;
         if (millis()>ticker) {
             Xcb(2,id);      // Callback with progress
             ticker = millis()+800;
         }
-        delay(50);
+        if (!bodyEnded) delay(50);
     }
 
-    httpsClient.stop();
-    if (bChunked) lastErrorMessage = "WARNING: Chunked response! ";
+    if (capture) capture->end();
+    // Keep the connection for the next poll if we've read exactly the whole response
+    if (!keepAlive || !bodyEnded || dechunker.isError()) soapClient.stop();
+    lastBytesReceived += dataReceived;
+    lastBytesDecoded += inflater.getBytesOut();
+    lastCompressed |= inflater.isCompressed();
     if (millis() >= dataSendTimeout) {
         lastErrorMessage += F("Timed out during data receive operation - ");
         lastErrorMessage += String(dataReceived) + F(" bytes received");
         return UPD_TIMEOUT;
     }
 
-    if (!xStation.location[0]) {
+    if (!parser.isDocumentComplete()) {
+        // The connection dropped part way through, or the body is corrupt. Whatever we've read so far can't be trusted.
+        lastErrorMessage += F("Incomplete response - ");
+        lastErrorMessage += String(dataReceived) + F(" bytes received");
+        if (dechunker.isError()) lastErrorMessage += F(", invalid chunked encoding");
+        if (inflater.isError()) lastErrorMessage += F(", invalid gzip data");
+        if (parser.getErrorPosition() >= 0) {
+            lastErrorMessage += F(", XML error at byte ");
+            lastErrorMessage += String(parser.getErrorPosition());
+        }
+        return UPD_INCOMPLETE;
+    }
+    if (dropService) discardService();      // The last service read was already on the board
+    return UPD_SUCCESS;
+}
+
+//
+// Requests the Departure Board data from the SOAP API, with or without the calling points and formation
+//
+int raildataXmlClient::requestDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, bool withDetails) {
+
+    unsigned long perfTimer=millis();
+    lastErrorMessage = "";
+    lastBytesReceived = 0;
+    lastBytesDecoded = 0;
+    lastCompressed = false;
+
+    // Reset the counters
+    xStation.numServices=0;
+    xMessages.numMessages=0;
+    xStation.platformAvailable=false;
+    addedStopLocation = false;
+    arena.reset();
+    xStation.location = {};
+
+    for (int i=0;i<MAXBOARDSERVICES;i++) clearService(i);
+    for (int i=0;i<MAXBOARDMESSAGES;i++) xMessages.messages[i] = {};
+    id=-1;
+    coaches=0;
+    dropService=false;
+    boardMinutes=-1;
+    strcpy(generatedAt,"");
+
+    // Darwin filters the services on the calling point, so only the ones wanted are sent
+    if (callingCrsCode[0]) {
+        strcpy(filterCrs,callingCrsCode);
+        filter=true;
+    } else {
+        strcpy(filterCrs,"");
+        filter=false;
+    }
+    includeBuses=includeBusServices;
+    listStart=0;
+    maxRows=numRows;
+
+    if (withDetails) detailPolls++; else boardPolls++;
+    // A filtered board may not fill up within the first time window, so later windows are asked for until it does
+    for (page=0;page<FILTERPAGES;page++) {
+        int timeOffset = page * FILTERTIMEWINDOW;
+        if (timeOffset > FILTERMAXOFFSET) timeOffset = FILTERMAXOFFSET;
+        if (page) filterPages++;
+        int result = requestPage(crsCode,customToken,numRows-xStation.numServices,withDetails,timeOffset);
+        if (result == UPD_THROTTLED && page) {
+            // Out of budget for the later windows, so show what the earlier ones found rather than nothing
+            lastErrorMessage = F("Request budget used up, board not filled - ");
+            break;
+        }
+        if (result != UPD_SUCCESS) return result;
+        if (!filter || xStation.numServices >= numRows) break;
+    }
+
+    if (!xStation.location.length) {
         // We didn't get a location back so probably failed
         lastErrorMessage += F("Data incomplete - no location in response");
         return UPD_DATA_ERROR;
     }
-    if (filter && !keepRoute && xStation.numServices) xStation.numServices--;   // Last route added needs filtering out
 
     sanitiseData();
     if (includeBusServices) {
@@ -361,76 +564,188 @@ int raildataXmlClient::updateDepartures(rdStation *station, stnMessages *message
         }
     }
 
-    bool noUpdate = true;
-    if (!firstDataLoad) {
-        // Check for any changes
-        if (messages->numMessages != xMessages.numMessages || station->numServices != xStation.numServices || station->platformAvailable != xStation.platformAvailable || strcmp(station->location,xStation.location)) noUpdate=false;
-        else {
-            for (int i=0;i<xMessages.numMessages;i++) {
-                if (strcmp(messages->messages[i],xMessages.messages[i])) {
-                    noUpdate=false;
-                    break;
-                }
-            }
-            if (noUpdate) {
-                for (int i=0;i<xStation.numServices;i++) {
-                    if (strcmp(station->service[i].sTime, xStation.service[i].sTime) || strcmp(station->service[i].destination, xStation.service[i].destination) || strcmp(station->service[i].via, xStation.service[i].via) || strcmp(station->service[i].etd, xStation.service[i].etd) || strcmp(station->service[i].platform, xStation.service[i].platform)) {
-                        noUpdate=false;
-                        break;
-                    }
-                    if (station->service[i].isCancelled != xStation.service[i].isCancelled || station->service[i].isDelayed != xStation.service[i].isDelayed || station->service[i].trainLength != xStation.service[i].trainLength || station->service[i].classesAvailable != xStation.service[i].classesAvailable || station->service[i].serviceType != xStation.service[i].serviceType) {
-                        noUpdate=false;
-                        break;
-                    }
-                }
-            }
-        }
-    } else {
+    if (withDetails) {
+        saveDetails(crsCode);
+        lastDetailPoll = millis();
+    } else if (!applyDetails()) {
+        // The first service has changed. An arrivals and departures board is one request a poll, so it goes without
+        // its calling points until the next poll asks for the details.
+        if (!arrivals) return UPD_NEED_DETAILS;
+        detailsValid = false;
+    }
+
+    // Compare fingerprints of what the board shows with the last update, so the caller can redraw just what changed
+    uint16_t rowChanges = 0;
+    uint8_t messageChanges = 0;
+    for (int i=0;i<MAXBOARDSERVICES;i++) {
+        uint32_t hash = (i < xStation.numServices) ? hashRow(i) : 0;
+        if (hash != rowHash[i]) rowChanges |= (1 << i);
+        rowHash[i] = hash;
+    }
+    for (int i=0;i<MAXBOARDMESSAGES;i++) {
+        uint32_t hash = (i < xMessages.numMessages) ? hashText(FNV_OFFSET,arena.get(xMessages.messages[i])) : 0;
+        if (hash != messageHash[i]) messageChanges |= (1 << i);
+        messageHash[i] = hash;
+    }
+    uint32_t hash = hashDetails();
+    bool detailsChanged = (hash != detailHash);
+    detailHash = hash;
+    if (firstDataLoad) {
         firstDataLoad=false;
-        noUpdate=false;
+        rowChanges = (1 << MAXBOARDSERVICES) - 1;
+        messageChanges = (1 << MAXBOARDMESSAGES) - 1;
+        detailsChanged = true;
     }
+    bool noUpdate = !rowChanges && !messageChanges && !detailsChanged;
+    station->rowChanges = rowChanges;
+    station->messageChanges = messageChanges;
+    station->detailsChanged = detailsChanged;
 
     if (!noUpdate) {
-        // copy everything back to the caller's structure
+        // Fill in the caller's board (the one it isn't showing)
         messages->numMessages = xMessages.numMessages;
         station->numServices = xStation.numServices;
-        strcpy(station->location,xStation.location);
+        strcpy(station->location,arena.get(xStation.location));
         station->platformAvailable = xStation.platformAvailable;
-        for (int i=0;i<xMessages.numMessages;i++) strcpy(messages->messages[i],xMessages.messages[i]);
+        for (int i=0;i<xMessages.numMessages;i++) strcpy(messages->messages[i],arena.get(xMessages.messages[i]));
         for (int i=0;i<xStation.numServices;i++) {
             strcpy(station->service[i].sTime, xStation.service[i].sTime);
-            strcpy(station->service[i].destination, xStation.service[i].destination);
-            strcpy(station->service[i].via, xStation.service[i].via);
+            if (!xStation.service[i].sTime[0] && xStation.service[i].origin.length) {
+                // Terminates here, so where it's arriving from is more use than where it's going
+                strcpy(station->service[i].destination, arena.get(xStation.service[i].origin));
+            } else {
+                strcpy(station->service[i].destination, arena.get(xStation.service[i].destination));
+            }
+            strcpy(station->service[i].via, arena.get(xStation.service[i].via));
             strcpy(station->service[i].etd, xStation.service[i].etd);
+            strcpy(station->service[i].sta, xStation.service[i].sta);
+            strcpy(station->service[i].eta, xStation.service[i].eta);
             strcpy(station->service[i].platform, xStation.service[i].platform);
             station->service[i].isCancelled = xStation.service[i].isCancelled;
             station->service[i].isDelayed = xStation.service[i].isDelayed;
             station->service[i].trainLength = xStation.service[i].trainLength;
             station->service[i].classesAvailable = xStation.service[i].classesAvailable;
-            strcpy(station->service[i].opco, xStation.service[i].opco);
+            strcpy(station->service[i].opco, arena.get(xStation.service[i].opco));
             station->service[i].serviceType = xStation.service[i].serviceType;
         }
         if (xStation.numServices) {
-            strcpy(station->calling,xStation.service[0].calling);
-            strcpy(station->origin,xStation.service[0].origin);
-            strcpy(station->serviceMessage,xStation.service[0].serviceMessage);
+            strcpy(station->calling,arena.get(xStation.service[0].calling));
+            strcpy(station->origin,arena.get(xStation.service[0].origin));
+            strcpy(station->serviceMessage,arena.get(xStation.service[0].serviceMessage));
         }
     }
 
     Xcb(3,xStation.numServices);
+    if (arena.hasOverflowed()) lastErrorMessage += F("WARNING: Text truncated, arena full! ");
     if (noUpdate) {
-        lastErrorMessage += "Success (No Changes) - data [" + String(dataReceived) + F("] load took ") + String(millis()-perfTimer) + F("ms");
+        lastErrorMessage += "Success (No Changes) - data [" + String(lastBytesReceived) + F("] load took ") + String(millis()-perfTimer) + F("ms");
         return UPD_NO_CHANGE;
     } else {
-        lastErrorMessage += "Success - data [" + String(dataReceived) + F("] took ") + String(millis()-perfTimer) + F("ms");
+        lastErrorMessage += "Success - data [" + String(lastBytesReceived) + F("] took ") + String(millis()-perfTimer) + F("ms");
         return UPD_SUCCESS;
     }
 }
 
+//
+// Opens a new connection to the SOAP host, timing the TLS handshake
+//
+bool raildataXmlClient::connectSoapHost() {
+    unsigned long connectStart = millis();
+    int retryCounter=0; //retry counter
+    while((!soapClient.connect(soapHost, 443)) && (retryCounter < 30)) {
+        delay(100);
+        retryCounter++;
+    }
+    if (retryCounter>=30) return false;
+    soapHandshakes++;
+    lastConnectTime = millis() - connectStart;
+    totalConnectTime += lastConnectTime;
+    return true;
+}
+
+//
+// Returns a summary of how the connection to the SOAP host is being reused
+//
+String raildataXmlClient::getConnectionStats() {
+    String stats = endpointCached ? F("endpoint from cache, ") : F("endpoint from WSDL, ");
+    stats += String(soapRequests) + F(" requests, ") + String(soapHandshakes) + F(" TLS handshakes, ") + String(soapReused) + F(" reused connections");
+    if (soapRequests) stats += " (" + String((soapReused * 100) / soapRequests) + F("%)");
+    stats += ", " + String(boardPolls) + F(" board / ") + String(detailPolls) + F(" detail requests");
+    if (filterPages) stats += ", " + String(filterPages) + F(" later time windows for the calling point filter");
+    stats += ", text arena " + String(arena.getHighWater()) + F(" of ") + String(TEXTARENASIZE) + F(" bytes used at most");
+    if (arena.hasOverflowed()) stats += F(" (last update truncated)");
+    if (soapHandshakes) stats += ", connect time last " + String(lastConnectTime) + F("ms avg ") + String(totalConnectTime / soapHandshakes) + F("ms");
+    if (lastBytesReceived) {
+        stats += ", last response " + String(lastBytesReceived) + F(" bytes");
+        if (lastCompressed) stats += " gzip (" + String(lastBytesDecoded) + F(" bytes of XML)");
+    }
+    return stats;
+}
+
+//
+// Sets where the body of each response is kept as it's received (nullptr for nowhere)
+//
+void raildataXmlClient::setCapture(responseCapture *capture) {
+    this->capture = capture;
+}
+
 String raildataXmlClient::getLastError() {
     return lastErrorMessage;
 }
 
+void raildataXmlClient::clearService(int x) {
+    strcpy(xStation.service[x].sTime,"");
+    xStation.service[x].destination = {};
+    xStation.service[x].via = {};
+    xStation.service[x].origin = {};
+    strcpy(xStation.service[x].etd,"");
+    strcpy(xStation.service[x].sta,"");
+    strcpy(xStation.service[x].eta,"");
+    strcpy(xStation.service[x].platform,"");
+    xStation.service[x].opco = {};
+    xStation.service[x].calling = {};
+    xStation.service[x].serviceMessage = {};
+    strcpy(xStation.service[x].serviceID,"");
+    xStation.service[x].trainLength=0;
+    xStation.service[x].classesAvailable=0;
+    xStation.service[x].serviceType=0;
+    xStation.service[x].sortKey=0;
+    xStation.service[x].isCancelled=false;
+    xStation.service[x].isDelayed=false;
+}
+
+//
+// Moves on to the next slot for the service that's starting
+//
+void raildataXmlClient::startService() {
+    // First drop the previous one if it was a repeat from the last page
+    if (dropService) discardService();
+    if (id>=0) {
+        if (xStation.service[id].trainLength == 0) xStation.service[id].trainLength = coaches;
+    }
+    coaches=0;
+    if (id < MAXBOARDSERVICES-1) {
+        id++;
+        xStation.numServices++;
+    } else {
+        // The board is full so this service goes in the last slot, and the text of the one there is freed
+        arena.release(serviceTextStart);
+        clearService(id);
+    }
+    serviceTextStart = arena.mark();
+}
+
+//
+// Drops the service being read (always the last one), along with its text
+//
+void raildataXmlClient::discardService() {
+    arena.release(serviceTextStart);   // Everything since this service started is its text
+    clearService(id);
+    xStation.numServices--;
+    id--;
+    dropService = false;
+}
+
 void raildataXmlClient::deleteService(int x) {
 
   if (x==xStation.numServices-1) {
@@ -449,210 +764,388 @@ void raildataXmlClient::sanitiseData() {
 
   int i=0;
   while (i<xStation.numServices) {
-    // Remove any services that are missing destinations/std/etd
-    if (!xStation.service[i].destination[0] || !xStation.service[i].etd[0] || !xStation.service[i].sTime[0]) deleteService(i);
+    // Remove any services that are missing destinations/std/etd (or sta/eta for arrivals)
+    if (!isComplete(i)) deleteService(i);
     else i++;
   }
 
-  // Issue #5 - Ampersands in Station Location
-  removeHtmlTags(xStation.location);
-  replaceWord(xStation.location,"&amp;","&");
+  // Issue #5 - Ampersands in Station Location (now decoded by the parser)
+  normalise(xStation.location,fieldText);
 
   for (int i=0;i<xStation.numServices;i++) {
-    // first change any &lt; &gt;
-    removeHtmlTags(xStation.service[i].destination);
-    replaceWord(xStation.service[i].destination,"&amp;","&");
-    removeHtmlTags(xStation.service[i].calling);
-    replaceWord(xStation.service[i].calling,"&amp;","&");
-    removeHtmlTags(xStation.service[i].via);
-    replaceWord(xStation.service[i].via,"&amp;","&");
-    removeHtmlTags(xStation.service[i].serviceMessage);
-    replaceWord(xStation.service[i].serviceMessage,"&amp;","&");
-    replaceWord(xStation.service[i].serviceMessage,"&quot;","\"");
-    fixFullStop(xStation.service[i].serviceMessage);
+    normalise(xStation.service[i].destination,fieldText);
+    normalise(xStation.service[i].calling,fieldText);
+    normalise(xStation.service[i].via,fieldText);
   }
+  // Messages have already been tidied by finishMessage() as they were read
+}
+
+//
+// Whether a service has what's needed to show it - a destination and its departure times, or its arrival times
+// if arrivals were asked for
+//
+bool raildataXmlClient::isComplete(int x) {
+    rdiService *s = &xStation.service[x];
+    if (!s->destination.length) return false;
+    if (s->sTime[0] && s->etd[0]) return true;
+    return arrivals && s->sta[0] && s->eta[0];
+}
 
-  for (int i=0;i<xMessages.numMessages;i++) {
-    // Remove all non printing characters from messages...
-    int j = 0; // Index for the modified array
-    for (int x=0; xMessages.messages[i][x] != '\0'; ++x) {
-        if (isprint(xMessages.messages[i][x])) {
-            xMessages.messages[i][j] = xMessages.messages[i][x];
-            ++j;
+//
+// Checks whether the current trainServices/busServices list already has DETAILCACHESIZE services ahead of the
+// one being parsed that will be kept. Only the first few services of each list can end up in the detail cache,
+// so detail that's only shown for the top service can be skipped for the rest.
+//
+bool raildataXmlClient::haveDetailedServices() {
+    int kept = 0;
+    for (int i=listStart;i<id;i++) {
+        if (isComplete(i) && (includeBuses || xStation.service[i].serviceType != BUS)) kept++;
+    }
+    return kept >= DETAILCACHESIZE;
+}
+
+//
+// FNV-1a hash of a string, continuing from hash. A terminator is hashed too, so adjacent fields can't run together.
+//
+uint32_t raildataXmlClient::hashText(uint32_t hash, const char *text) {
+    while (*text) {
+        hash = (hash ^ (uint8_t)*text++) * FNV_PRIME;
+    }
+    return hash * FNV_PRIME;
+}
+
+uint32_t raildataXmlClient::hashValue(uint32_t hash, uint32_t value) {
+    for (int i=0;i<4;i++) {
+        hash = (hash ^ (value & 0xFF)) * FNV_PRIME;
+        value >>= 8;
+    }
+    return hash;
+}
+
+//
+// Fingerprint of the departure line drawn for a service
+//
+uint32_t raildataXmlClient::hashRow(int i) {
+    rdiService *s = &xStation.service[i];
+    uint32_t hash = hashText(FNV_OFFSET,s->sTime);
+    hash = hashText(hash,arena.get(s->destination));
+    hash = hashText(hash,arena.get(s->via));
+    hash = hashText(hash,s->etd);
+    hash = hashText(hash,s->sta);
+    hash = hashText(hash,s->eta);
+    if (!s->sTime[0]) hash = hashText(hash,arena.get(s->origin));    // Shown in place of the destination
+    hash = hashText(hash,s->platform);
+    return hashValue(hash,(s->serviceType << 8) | (s->isCancelled << 2) | (s->isDelayed << 1) | xStation.platformAvailable);
+}
+
+//
+// Fingerprint of everything else at the top of the board - the station name and the messages about the first
+// service (calling points, origin, operator, formation and delay reason)
+//
+uint32_t raildataXmlClient::hashDetails() {
+    uint32_t hash = hashText(FNV_OFFSET,arena.get(xStation.location));
+    if (!xStation.numServices) return hash;
+    rdiService *s = &xStation.service[0];
+    hash = hashText(hash,arena.get(s->calling));
+    hash = hashText(hash,arena.get(s->origin));
+    hash = hashText(hash,arena.get(s->opco));
+    hash = hashText(hash,arena.get(s->serviceMessage));
+    return hashValue(hash,(s->trainLength << 16) | (s->classesAvailable << 8) | (s->isCancelled << 1) | s->isDelayed);
+}
+
+//
+// Keeps the calling points and formation of the services at the top of a GetDepBoardWithDetails response
+//
+void raildataXmlClient::saveDetails(const char *crsCode) {
+    int saved = 0;
+    for (int i=0;i<xStation.numServices && saved<DETAILCACHESIZE;i++) {
+        if (!xStation.service[i].serviceID[0]) continue;
+        strcpy(detailCache[saved].serviceID,xStation.service[i].serviceID);
+        strcpy(detailCache[saved].calling,arena.get(xStation.service[i].calling));
+        detailCache[saved].trainLength = xStation.service[i].trainLength;
+        detailCache[saved].classesAvailable = xStation.service[i].classesAvailable;
+        saved++;
+    }
+    for (;saved<DETAILCACHESIZE;saved++) strcpy(detailCache[saved].serviceID,"");
+    strlcpy(detailCrs,crsCode,sizeof(detailCrs));
+    detailsValid = true;
+}
+
+//
+// Fills in the calling points and formation of a GetDepartureBoard response from the detail cache. Returns
+// false if the first service isn't in the cache, so the details need requesting again. A first service without
+// a serviceID can't be looked up, so it goes without until the next DETAILREFRESHINTERVAL request.
+//
+bool raildataXmlClient::applyDetails() {
+    bool haveFirst = (xStation.numServices == 0) || !xStation.service[0].serviceID[0];
+    for (int i=0;i<xStation.numServices;i++) {
+        if (!xStation.service[i].serviceID[0]) continue;
+        for (int j=0;j<DETAILCACHESIZE;j++) {
+            if (strcmp(detailCache[j].serviceID,xStation.service[i].serviceID)) continue;
+            arena.set(xStation.service[i].calling,detailCache[j].calling,MAXMESSAGESIZE-1);
+            if (!xStation.service[i].trainLength) xStation.service[i].trainLength = detailCache[j].trainLength;
+            xStation.service[i].classesAvailable = detailCache[j].classesAvailable;
+            if (i == 0) haveFirst = true;
+            break;
         }
     }
-    xMessages.messages[i][j] = '\0'; // Null-terminate the modified array
-    replaceWord(xMessages.messages[i],"&lt;","<");
-    replaceWord(xMessages.messages[i],"&gt;",">");
-    replaceWord(xMessages.messages[i],"<p>","");
-    replaceWord(xMessages.messages[i],"</p>","");
-    replaceWord(xMessages.messages[i],"<br>"," ");
-
-    removeHtmlTags(xMessages.messages[i]);
-    replaceWord(xMessages.messages[i],"&amp;","&");
-    replaceWord(xMessages.messages[i],"&quot;","\"");
-    // Remove unwanted text at the end of service messages...
-    pruneFromPhrase(xMessages.messages[i]," More details ");
-    pruneFromPhrase(xMessages.messages[i]," Latest information ");
-    pruneFromPhrase(xMessages.messages[i]," Further information ");
-
-    fixFullStop(xMessages.messages[i]);
-  }
+    return haveFirst;
 }
 
-void raildataXmlClient::startTag(const char *tag)
+int raildataXmlClient::startTag(const char *tag, const xmlTagStack &tags)
 {
-    tagLevel++;
-    grandParentTagName = parentTagName;
-    parentTagName = tagName;
-    tagName = String(tag);
-    tagPath = grandParentTagName + "/" + parentTagName + "/" + tagName;
+    if (loadingWDSL || tags.currentNs() != NS_DARWIN) return XML_CONTINUE;
+
+    switch (tags.current()) {
+        case TAG_TRAINSERVICES:
+        case TAG_BUSSERVICES:
+            listStart = id + 1;
+            break;
+
+        case TAG_SERVICE:
+            // A service may start with its arrival or its departure, so the slot is taken here
+            if (tags.depth == DEPTH_SERVICE-1) startService();
+            break;
+
+        case TAG_PREVIOUSCALLINGPOINTS:
+            return XML_SKIP;    // Never displayed
+
+        case TAG_SUBSEQUENTCALLINGPOINTS:
+            if (haveDetailedServices()) return XML_SKIP;
+            break;
+
+        case TAG_FORMATION:
+            if (haveDetailedServices()) return XML_SKIP;
+            break;
+    }
+    return XML_CONTINUE;
 }
 
-void raildataXmlClient::endTag(const char *tag)
+int raildataXmlClient::endTag(const char *tag, const xmlTagStack &tags)
 {
-    tagLevel--;
-    tagName = parentTagName;
-    parentTagName=grandParentTagName;
-    grandParentTagName="??";
+    if (loadingWDSL || tags.currentNs() != NS_DARWIN) return XML_CONTINUE;
+
+    // Stop reading as soon as we have everything we need, rather than waiting for the server to close the connection
+    switch (tags.current()) {
+        case TAG_GETSTATIONBOARDRESULT:
+            return XML_STOP;
+
+        case TAG_TRAINSERVICES:
+            // Bus services (if there are any) come next
+            if (!includeBuses) return XML_STOP;
+            break;
+
+        case TAG_SERVICE:
+            // Services can't be counted yet if bus services will be sorted in amongst them
+            if (!includeBuses && xStation.numServices >= maxRows) return XML_STOP;
+            break;
+    }
+    return XML_CONTINUE;
 }
 
 void raildataXmlClient::parameter(const char *param)
 {
 }
 
-void raildataXmlClient::value(const char *value)
+//
+// Appends a chunk of element text to a destination field, clearing it first if this is the start of the text.
+// Anything that doesn't fit is dropped.
+//
+void raildataXmlClient::appendValue(char *dest, size_t size, const char *value, size_t length, bool first) {
+    size_t used = first ? 0 : strlen(dest);
+    if (used + length > size - 1) length = (used < size - 1) ? size - 1 - used : 0;
+    memcpy(dest + used, value, length);
+    dest[used + length] = '\0';
+}
+
+void raildataXmlClient::appendValue(textRef &dest, size_t maxLength, const char *value, size_t length, bool first) {
+    if (first) arena.clear(dest);
+    arena.append(dest,value,length,maxLength);
+}
+
+void raildataXmlClient::valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags)
 {
+    // Long text arrives in several chunks. Text fields are appended to chunk by chunk, everything else is
+    // short enough to be acted on from the first chunk.
+    bool first = !valueContinues;
+    valueContinues = !last;
+
     if (loadingWDSL) return;
+    if (tags.currentNs() != NS_DARWIN) return;
 
-    if (tagLevel<6 || tagLevel==9 || tagLevel>11) return;
+    int tagLevel = tags.depth;
+    if (tagLevel<DEPTH_STATION || tagLevel==DEPTH_LOCATION-1 || tagLevel>DEPTH_CALLINGPOINT) return;  // Nothing we need at the location/callingPoint element level
 
-    if (tagLevel == 11 && tagPath.endsWith(F("callingPoint/lt8:locationName"))) {
-        if ((strlen(xStation.service[id].calling) + strlen(value) + 13) < sizeof(xStation.service[0].calling)) {
-            // Add the calling point, add a comma prefix if this isn't the first one
-            if (xStation.service[id].calling[0]) strcat(xStation.service[id].calling,", ");
-            strcat(xStation.service[id].calling,value);
-            addedStopLocation = true;
-        }
-        return;
-    } else if (filter && tagLevel == 11 && tagPath.endsWith(F("callingPoint/lt8:crs")) && addedStopLocation) {
-        // check if we should keep this route?
-        if (strcmp(filterCrs,value)==0) keepRoute = true;
-        return;
-    } else if (tagLevel == 11 && tagPath.endsWith(F("callingPoint/lt8:st")) && addedStopLocation) {
-        // check there's still room to add the eta of the calling point
-        if ((strlen(xStation.service[id].calling) + strlen(value) + 4) < sizeof(xStation.service[0].calling)) {
-            strcat(xStation.service[id].calling," (");
-            strcat(xStation.service[id].calling,value);
-            strcat(xStation.service[id].calling,")");
-        }
-        addedStopLocation = false;
-        return;
-    } else if (tagLevel == 11 && tagName == F("lt7:coachClass")) {
-        if (strcmp(value,"First")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 1;
-        else if (strcmp(value,"Standard")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 2;
-        coaches++;
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:length")) {
-        xStation.service[id].trainLength = String(value).toInt();
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:operator")) {
-        strncpy(xStation.service[id].opco,value,sizeof(xStation.service[0].opco)-1);
-        xStation.service[id].opco[sizeof(xStation.service[0].opco)-1] = '\0';
-        return;
-    } else if (tagLevel == 10 && tagPath.startsWith(F("lt5:origin/lt4:location/lt4:loc"))) {
-        strncpy(xStation.service[id].origin,value,sizeof(xStation.service[0].origin)-1);
-        xStation.service[id].origin[sizeof(xStation.service[0].origin)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:serviceType")) {
-        if (strcmp(value,"train")==0) xStation.service[id].serviceType = TRAIN;
-        else if (strcmp(value,"bus")==0) xStation.service[id].serviceType = BUS;
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:std")) {
-        // Starting a new service
-        // If we're filtering on calling point, check if we need to keep the previous service (if there was one)
-        if (filter && !keepRoute && id>=0) {
-            // We don't want this service, so clear it
-            strcpy(xStation.service[id].sTime,"");
-            strcpy(xStation.service[id].destination,"");
-            strcpy(xStation.service[id].via,"");
-            strcpy(xStation.service[id].origin,"");
-            strcpy(xStation.service[id].etd,"");
-            strcpy(xStation.service[id].platform,"");
-            strcpy(xStation.service[id].opco,"");
-            strcpy(xStation.service[id].calling,"");
-            strcpy(xStation.service[id].serviceMessage,"");
-            xStation.service[id].trainLength=0;
-            xStation.service[id].classesAvailable=0;
-            xStation.service[id].serviceType=0;
-            xStation.service[id].isCancelled=false;
-            xStation.service[id].isDelayed=false;
-            xStation.numServices--;
-            id--;
-        }
-        keepRoute = false;  // reset for next route
-        if (id>=0) {
-            if (xStation.service[id].trainLength == 0) xStation.service[id].trainLength = coaches;
-        }
-        coaches=0;
-        if (id < MAXBOARDSERVICES-1) {
-            id++;
-            xStation.numServices++;
-        }
-        strncpy(xStation.service[id].sTime,value,sizeof(xStation.service[0].sTime));
-        xStation.service[id].sTime[sizeof(xStation.service[0].sTime)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:etd")) {
-        strncpy(xStation.service[id].etd,value,sizeof(xStation.service[0].etd));
-        xStation.service[id].etd[sizeof(xStation.service[0].etd)-1] = '\0';
-        return;
-    } else if (tagLevel == 10 && tagPath.startsWith(F("lt5:destination/lt4:location/lt4:lo"))) {
-        strncpy(xStation.service[id].destination,value,sizeof(xStation.service[0].destination)-1);
-        xStation.service[id].destination[sizeof(xStation.service[0].destination)-1] = '\0';
-        return;
-    } else if (tagLevel == 10 && tagPath == F("lt5:destination/lt4:location/lt4:via")) {
-        strncpy(xStation.service[id].via,value,sizeof(xStation.service[0].via)-1);
-        xStation.service[id].via[sizeof(xStation.service[0].via)-1] = '\0';
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:delayReason")) {
-        strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
-        xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
-        xStation.service[id].isDelayed = true;
-        return;
-    } else if (tagLevel == 8 && tagName == F("lt4:cancelReason")) {
-        strncpy(xStation.service[id].serviceMessage,value,sizeof(xStation.service[0].serviceMessage)-1);
-        xStation.service[id].serviceMessage[sizeof(xStation.service[0].serviceMessage)-1] = '\0';
-        xStation.service[id].isCancelled = true;
-        return;
-    } else if (tagLevel == 8 && tagName == (F("lt4:platform"))) {
-        strncpy(xStation.service[id].platform,value,sizeof(xStation.service[0].platform)-1);
-        xStation.service[id].platform[sizeof(xStation.service[0].platform)-1] = '\0';
-        return;
-    } else if (tagLevel == 6 && tagName == F("lt4:locationName")) {
-        strncpy(xStation.location,value,sizeof(xStation.location)-1);
-        xStation.location[sizeof(xStation.location)-1] = '\0';
-        return;
-    } else if (tagLevel == 6 && tagName == F("lt4:platformAvailable")) {
-        if (strcmp(value,"true")==0) xStation.platformAvailable = true;
-        return;
-    } else if (tagPath.endsWith(F("nrccMessages/lt:message"))) {    // tagLevel 7
-        if (xMessages.numMessages < MAXBOARDMESSAGES) {
-            xMessages.numMessages++;
-            strncpy(xMessages.messages[xMessages.numMessages-1],value,sizeof(xMessages.messages[0])-1);
-            xMessages.messages[xMessages.numMessages-1][sizeof(xMessages.messages[0])-1] = '\0';
-        }
-        return;
+    switch (tags.current()) {
+        case TAG_LOCATIONNAME:
+            if (tagLevel == DEPTH_CALLINGPOINT && tags.parent() == TAG_CALLINGPOINT) {
+                textRef &calling = xStation.service[id].calling;
+                if (first) {
+                    addedStopLocation = false;
+                    if ((calling.length + length + 13) < MAXMESSAGESIZE) {
+                        // Add the calling point, add a comma prefix if this isn't the first one
+                        if (calling.length) arena.append(calling,", ",2,MAXMESSAGESIZE-1);
+                        addedStopLocation = true;
+                    }
+                }
+                // Leave room for the time to be added
+                if (addedStopLocation) appendValue(calling,MAXMESSAGESIZE-13,value,length,false);
+            } else if (tagLevel == DEPTH_LOCATION && tags.parent() == TAG_LOCATION) {
+                if (tags.grandParent() == TAG_ORIGIN) {
+                    appendValue(xStation.service[id].origin,MAXLOCATIONSIZE-1,value,length,first);
+                } else if (tags.grandParent() == TAG_DESTINATION) {
+                    appendValue(xStation.service[id].destination,MAXLOCATIONSIZE-1,value,length,first);
+                }
+            } else if (tagLevel == DEPTH_STATION && !page) {
+                appendValue(xStation.location,MAXLOCATIONSIZE-1,value,length,first);
+            }
+            return;
+
+        case TAG_ST:
+            if (first && tagLevel == DEPTH_CALLINGPOINT && tags.parent() == TAG_CALLINGPOINT && addedStopLocation) {
+                // check there's still room to add the eta of the calling point
+                textRef &calling = xStation.service[id].calling;
+                if ((calling.length + length + 4) < MAXMESSAGESIZE) {
+                    arena.append(calling," (",2,MAXMESSAGESIZE-1);
+                    arena.append(calling,value,length,MAXMESSAGESIZE-1);
+                    arena.append(calling,")",1,MAXMESSAGESIZE-1);
+                }
+                addedStopLocation = false;
+            }
+            return;
+
+        case TAG_COACHCLASS:
+            if (first && tagLevel == DEPTH_CALLINGPOINT) {
+                if (strcmp(value,"First")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 1;
+                else if (strcmp(value,"Standard")==0) xStation.service[id].classesAvailable = xStation.service[id].classesAvailable | 2;
+                coaches++;
+            }
+            return;
+
+        case TAG_LENGTH:
+            if (first && tagLevel == DEPTH_SERVICE) xStation.service[id].trainLength = atoi(value);
+            return;
+
+        case TAG_OPERATOR:
+            if (tagLevel == DEPTH_SERVICE) appendValue(xStation.service[id].opco,sizeof(rdService::opco)-1,value,length,first);
+            return;
+
+        case TAG_SERVICETYPE:
+            if (first && tagLevel == DEPTH_SERVICE) {
+                if (strcmp(value,"train")==0) xStation.service[id].serviceType = TRAIN;
+                else if (strcmp(value,"bus")==0) xStation.service[id].serviceType = BUS;
+            }
+            return;
+
+        case TAG_GENERATEDAT:
+            // Only the first page's time is used, so all of the services' keys are from the same point
+            if (tagLevel == DEPTH_STATION && !page) {
+                appendValue(generatedAt,sizeof(generatedAt),value,length,first);
+                const char *timeOfDay = strchr(generatedAt,'T');
+                if (last && timeOfDay) boardMinutes = timeMinutes(timeOfDay+1);
+            }
+            return;
+
+        case TAG_STD:
+            if (tagLevel == DEPTH_SERVICE) {
+                appendValue(xStation.service[id].sTime,sizeof(xStation.service[0].sTime),value,length,first);
+                // Services that arrive here are ordered by their arrival (sta comes before std)
+                if (last && !xStation.service[id].sta[0]) xStation.service[id].sortKey = serviceKey(xStation.service[id].sTime);
+            }
+            return;
+
+        case TAG_ETD:
+            if (tagLevel == DEPTH_SERVICE) appendValue(xStation.service[id].etd,sizeof(xStation.service[0].etd),value,length,first);
+            return;
+
+        case TAG_STA:
+            if (tagLevel == DEPTH_SERVICE && arrivals) {
+                appendValue(xStation.service[id].sta,sizeof(xStation.service[0].sta),value,length,first);
+                if (last) xStation.service[id].sortKey = serviceKey(xStation.service[id].sta);
+            }
+            return;
+
+        case TAG_ETA:
+            if (tagLevel == DEPTH_SERVICE && arrivals) appendValue(xStation.service[id].eta,sizeof(xStation.service[0].eta),value,length,first);
+            return;
+
+        case TAG_SERVICEID:
+            if (tagLevel == DEPTH_SERVICE) {
+                appendValue(xStation.service[id].serviceID,sizeof(xStation.service[0].serviceID),value,length,first);
+                // Time windows overlap by a minute, so a later page can repeat a service
+                for (int i=0;last && page && i<id;i++) {
+                    if (strcmp(xStation.service[i].serviceID,xStation.service[id].serviceID)==0) dropService = true;
+                }
+            }
+            return;
+
+        case TAG_VIA:
+            if (tagLevel == DEPTH_LOCATION && tags.parent() == TAG_LOCATION && tags.grandParent() == TAG_DESTINATION) {
+                appendValue(xStation.service[id].via,MAXLOCATIONSIZE-1,value,length,first);
+            }
+            return;
+
+        case TAG_DELAYREASON:
+            if (tagLevel == DEPTH_SERVICE) {
+                appendValue(xStation.service[id].serviceMessage,MAXMESSAGESIZE-1,value,length,first);
+                if (last) finishMessage(xStation.service[id].serviceMessage,false);
+                xStation.service[id].isDelayed = true;
+            }
+            return;
+
+        case TAG_CANCELREASON:
+            if (tagLevel == DEPTH_SERVICE) {
+                appendValue(xStation.service[id].serviceMessage,MAXMESSAGESIZE-1,value,length,first);
+                if (last) finishMessage(xStation.service[id].serviceMessage,false);
+                xStation.service[id].isCancelled = true;
+            }
+            return;
+
+        case TAG_PLATFORM:
+            if (tagLevel == DEPTH_SERVICE) appendValue(xStation.service[id].platform,sizeof(xStation.service[0].platform),value,length,first);
+            return;
+
+        case TAG_PLATFORMAVAILABLE:
+            if (first && tagLevel == DEPTH_STATION && strcmp(value,"true")==0) xStation.platformAvailable = true;
+            return;
+
+        case TAG_MESSAGE:
+            if (tags.parent() == TAG_NRCCMESSAGES && !page) {    // tagLevel DEPTH_STATION+1, the same on every page
+                if (first) {
+                    addedMessage = false;
+                    if (xMessages.numMessages < MAXBOARDMESSAGES) {
+                        xMessages.numMessages++;
+                        addedMessage = true;
+                    }
+                }
+                if (addedMessage) {
+                    appendValue(xMessages.messages[xMessages.numMessages-1],MAXMESSAGESIZE-1,value,length,first);
+                    if (last) finishMessage(xMessages.messages[xMessages.numMessages-1],true);
+                }
+            }
+            return;
     }
 }
 
-void raildataXmlClient::attribute(const char *attr)
+void raildataXmlClient::attribute(const char *name, const char *value, const xmlTagStack &tags)
 {
-    if (loadingWDSL) {
-        if (tagName == "soap:address") {
-            String myURL = String(attr);
-            if (myURL.startsWith("location=\"") && myURL.endsWith("\"")) {
-                soapURL = myURL.substring(10,myURL.length()-1);
+    if (!loadingWDSL) return;
+
+    if (tags.current() == TAG_ADDRESS && tags.currentNs() == NS_WSDL_SOAP && strcmp(name,"location")==0) {
+        // Split the https:// endpoint url into the SOAP host and api url
+        if (strncmp(value,"https://",8)==0) {
+            const char *host = value + 8;
+            const char *api = strchr(host,'/');
+            if (api && (size_t)(api - host) < sizeof(soapHost)) {
+                memcpy(soapHost,host,api - host);
+                soapHost[api - host] = '\0';
+                strlcpy(soapAPI,api,sizeof(soapAPI));
+                foundSoapAddress = true;
             }
         }
+    } else if (tags.current() == TAG_DEFINITIONS && strcmp(name,"targetNamespace")==0) {
+        // The service namespace carries the schema version the WSDL was requested for. The root element's
+        // own xmlns:wsdl may be declared after this attribute, so its namespace isn't checked here.
+        if (strncmp(value,"http://thalesgroup.com/RTTI/",28)==0) strlcpy(ldbNamespace,value,sizeof(ldbNamespace));
     }
 }
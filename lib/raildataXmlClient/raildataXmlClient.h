@@ -10,62 +10,137 @@
  */
 
 #pragma once
+#include <WiFiClientSecure.h>
 #include <xmlListener.h>
-#include <xmlStreamingParser.h>
+#include <BasicXmlParser.h>
 #include <stationData.h>
+#include <darwinTags.h>
+#include <httpChunkDecoder.h>
+#include <httpInflater.h>
+#include <textArena.h>
+#include <textNormaliser.h>
+#include <responseCapture.h>
 
 typedef void (*rdCallback) (int state, int id);
 
 #define MAXHOSTSIZE 48
 #define MAXAPIURLSIZE 48
-
-
-class raildataXmlClient: public xmlListener {
+#define MAXNAMESPACESIZE 64
+#define DEFAULTLDBNAMESPACE "http://thalesgroup.com/RTTI/2021-11-01/ldb/"   // Used if the WSDL doesn't give a targetNamespace
+#define WSDLCACHEFILE "/wsdlcache.txt"   // SOAP endpoint from the last WSDL download
+#define WSDLCACHETTL 604800L            // Age (secs) after which the cached endpoint is checked against the WSDL again (7 days)
+#define READBUFFERSIZE 512  // Socket reads are passed to the XML parser in blocks of this size
+#define MAXSERVICEIDSIZE 40
+#define DETAILCACHESIZE 3           // Services at the top of the board whose calling points and formation are kept
+#define DETAILREFRESHINTERVAL 300000UL  // Longest time (ms) between GetDepBoardWithDetails requests (5 mins)
+#define UPD_NEED_DETAILS 100        // Internal - a board-only poll found a first service without cached details
+#define FNV_OFFSET 2166136261UL     // 32 bit FNV-1a hash, used to fingerprint board rows
+#define FNV_PRIME 16777619UL
+#define FILTERPAGES 2               // Most requests made to fill a board filtered on a calling point
+#define FILTERTIMEWINDOW 120        // Minutes covered by each of those requests (the most Darwin allows)
+#define FILTERMAXOFFSET 119         // Latest timeOffset Darwin accepts
+
+// Element depths in the GetDepartureBoard response (soap:Envelope is depth 1)
+#define DEPTH_STATION 5         // Station fields, e.g. locationName and platformAvailable
+#define DEPTH_SERVICE 7         // Service fields, e.g. std, etd and platform
+#define DEPTH_LOCATION 9        // Fields of an origin or destination location
+#define DEPTH_CALLINGPOINT 10   // Fields of a calling point or coach
+
+
+class raildataXmlClient {
 
     private:
+        friend class BasicXmlParser<raildataXmlClient>;    // Calls the XML handlers below directly
 
+        // Variable length text is held in the arena, and copied out to the caller's fixed size fields at the end
         struct rdiService {
           char sTime[6];
-          char destination[MAXLOCATIONSIZE];
-          char via[MAXLOCATIONSIZE];
-          char origin[MAXLOCATIONSIZE];
+          textRef destination;
+          textRef via;
+          textRef origin;
           char etd[11];
+          char sta[6];        // Only with arrivals
+          char eta[11];
           char platform[4];
           bool isCancelled;
           bool isDelayed;
           int trainLength;
           byte classesAvailable;
-          char opco[50];
-          char calling[MAXMESSAGESIZE];
-          char serviceMessage[MAXMESSAGESIZE];
+          textRef opco;
+          textRef calling;
+          textRef serviceMessage;
           int serviceType;
+          char serviceID[MAXSERVICEIDSIZE];
+          int sortKey;        // Minutes from when the board was generated to the service's time here
+        };
+
+        // The parts of a service that only GetDepBoardWithDetails returns
+        struct rdiDetails {
+          char serviceID[MAXSERVICEIDSIZE];
+          char calling[MAXMESSAGESIZE];
+          int trainLength;
+          byte classesAvailable;
         };
 
         struct rdiStation {
-          char location[MAXLOCATIONSIZE];
+          textRef location;
           bool platformAvailable;
           int numServices;
           rdiService service[MAXBOARDSERVICES];
         };
 
-        String grandParentTagName = "";
-        String parentTagName = "";
-        String tagName = "";
-        String tagPath = "";
-        int tagLevel = 0;
+        struct rdiMessages {
+          int numMessages;
+          textRef messages[MAXBOARDMESSAGES];
+        };
+
         bool loadingWDSL=false;
-        String soapURL = "";
+        bool foundSoapAddress = false;
+        bool endpointCached = false;    // The SOAP endpoint came from the cache rather than the WSDL
+        bool endpointStale = false;     // The cached endpoint is old enough to need checking against the WSDL
+        char wsdlHostName[MAXHOSTSIZE];
+        char wsdlApiUrl[MAXAPIURLSIZE];
         char soapHost[MAXHOSTSIZE];
         char soapAPI[MAXAPIURLSIZE];
+        char ldbNamespace[MAXNAMESPACESIZE];    // Request namespace for the WSDL version in use
+
+        httpChunkDecoder dechunker;
+        WiFiClientSecure soapClient;    // Left open between polls (HTTP keep-alive) to save a TLS handshake each time
+        unsigned long soapRequests = 0;
+        unsigned long soapHandshakes = 0;
+        unsigned long soapReused = 0;       // Requests sent on a connection kept from the previous poll
+        unsigned long lastConnectTime = 0;  // ms
+        unsigned long totalConnectTime = 0;
+        unsigned long boardPolls = 0;       // Requests without calling points and formation
+        unsigned long detailPolls = 0;
+        unsigned long filterPages = 0;      // Extra requests for later time windows to fill a filtered board
+        unsigned long lastDetailPoll = 0;   // millis() of the last successful GetDepBoardWithDetails request
+        bool detailsValid = false;
+        char detailCrs[4];                  // Station the cached details are for (calling points depend on it)
+        rdiDetails detailCache[DETAILCACHESIZE];
+        uint32_t rowHash[MAXBOARDSERVICES] = {};        // Fingerprints of the board as last returned to the caller
+        uint32_t messageHash[MAXBOARDMESSAGES] = {};
+        uint32_t detailHash = 0;
+        long lastBytesReceived = 0;         // Size of the last response as sent, and once inflated
+        uint32_t lastBytesDecoded = 0;
+        bool lastCompressed = false;
 
-        String currentPath = "";
         rdiStation xStation;
-        stnMessages xMessages;
+        rdiMessages xMessages;
+        textArena arena;                // Text of the update being read, emptied at the start of each request
+        uint16_t serviceTextStart = 0;  // Arena position where the text of the service being read starts
+        textNormaliser fieldText;           // Station and location names, calling points
+        textNormaliser messageText;         // Delay and cancellation reasons
+        textNormaliser stationMessageText;  // NRCC messages
+        responseCapture *capture = nullptr; // Where responses are kept for debugging, if anywhere
 
         bool addedStopLocation = false;
+        bool addedMessage = false;
+        bool valueContinues = false;    // The next valueChunk() continues the same element's text
         int id=0;
         int coaches=0;
         char buffer[MAXMESSAGESIZE];
+        char readBuffer[READBUFFERSIZE];
 
         String lastErrorMessage = "";
         bool firstDataLoad;
@@ -73,26 +148,57 @@ class raildataXmlClient: public xmlListener {
 
         char filterCrs[4];
         bool filter = false;
-        bool keepRoute = false;
+        int page = 0;               // Time window being read, later pages only add services
+        bool dropService = false;   // The service being read is already on the board
+        bool includeBuses = false;
+        bool arrivals = false;      // Asking for the combined arrivals and departures board
+        bool lastArrivals = false;  // Kind of board the detail cache was filled from
+        int listStart = 0;      // Index of the first service in the current trainServices/busServices list
+        int maxRows = 0;        // Services wanted, once we have this many there's no need to read any more
+        char generatedAt[20];   // Local date and time the board was generated, e.g. 2025-08-09T23:55:12
+        int boardMinutes = -1;  // Time of day (mins) of generatedAt, or the first service if it's missing
 
         rdCallback Xcb;
         static bool compareTimes(const rdiService& a, const rdiService& b);
-        void removeHtmlTags(char* input);
-        void replaceWord(char* input, const char* target, const char* replacement);
-        void pruneFromPhrase(char* input, const char* target);
-        void fixFullStop(char* input);
+        static int timeMinutes(const char *hhmm);
+        int serviceKey(const char *hhmm);
+        void normalise(textRef &ref, textNormaliser &normaliser);
+        void finishMessage(textRef &ref, bool isStationMessage);
         void sanitiseData();
+        void clearService(int x);
+        void startService();
+        void discardService();
+        bool isComplete(int x);
         void deleteService(int x);
-
-        virtual void startTag(const char *tagName);
-        virtual void endTag(const char *tagName);
-        virtual void parameter(const char *param);
-        virtual void value(const char *value);
-        virtual void attribute(const char *attribute);
+        void appendValue(char *dest, size_t size, const char *value, size_t length, bool first);
+        void appendValue(textRef &dest, size_t maxLength, const char *value, size_t length, bool first);
+        bool haveDetailedServices();
+        static uint32_t hashText(uint32_t hash, const char *text);
+        static uint32_t hashValue(uint32_t hash, uint32_t value);
+        uint32_t hashRow(int i);
+        uint32_t hashDetails();
+        void saveDetails(const char *crsCode);
+        bool applyDetails();
+        bool connectSoapHost();
+        int loadWsdl();
+        bool loadCachedEndpoint();
+        void saveCachedEndpoint();
+        int requestPage(const char *crsCode, const char *customToken, int numRows, bool withDetails, int timeOffset);
+        int requestDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, bool withDetails);
+
+        int startTag(const char *tagName, const xmlTagStack &tags);
+        int endTag(const char *tagName, const xmlTagStack &tags);
+        void parameter(const char *param);
+        void valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags);
+        void attribute(const char *name, const char *value, const xmlTagStack &tags);
 
     public:
         raildataXmlClient();
         int init(const char *wsdlHost, const char *wsdlAPI, rdCallback RDcb);
-        int updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode);
+        int updateDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, bool includeArrivals = false);
+        bool isEndpointStale();
+        int refreshEndpoint();
         String getLastError();
+        String getConnectionStats();
+        void setCapture(responseCapture *capture);
 };
\ No newline at end of file
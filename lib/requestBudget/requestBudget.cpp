@@ -0,0 +1,140 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Request Budget Library - limits how often each upstream API is called and backs off when asked to.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <requestBudget.h>
+
+requestBudget apiBudget;
+
+static const char * const upstreamNames[UPSTREAMS] = { "Darwin", "TfL", "OpenWeatherMap", "GitHub" };
+
+requestBudget::requestBudget() {
+    memset(buckets, 0, sizeof(buckets));
+    setLimit(UPSTREAM_DARWIN,DARWINPERHOUR,DARWINBURST);
+    setLimit(UPSTREAM_TFL,TFLPERHOUR,TFLBURST);
+    setLimit(UPSTREAM_WEATHER,WEATHERPERHOUR,WEATHERBURST);
+    setLimit(UPSTREAM_GITHUB,GITHUBPERHOUR,GITHUBBURST);
+}
+
+//
+// Sets an upstream's budget, starting with a full bucket. A perHour of 0 means no limit.
+//
+void requestBudget::setLimit(int upstream, uint16_t perHour, uint16_t burst) {
+    bucket &b = buckets[upstream];
+    b.perHour = perHour;
+    b.burst = burst ? burst : 1;
+    b.milliTokens = b.burst * 1000UL;
+    b.lastRefill = millis();
+}
+
+void requestBudget::refill(bucket &b) {
+    unsigned long now = millis();
+    uint32_t added = (uint64_t)(now - b.lastRefill) * b.perHour / 3600;     // perHour/3600 thousandths per ms
+    if (!added) return;     // Leave lastRefill alone so short gaps still add up
+    b.lastRefill = now;
+    b.milliTokens += added;
+    if (b.milliTokens > b.burst * 1000UL) b.milliTokens = b.burst * 1000UL;
+}
+
+// Thousandths of a request needed for a number of requests, no more than the bucket can hold
+uint32_t requestBudget::neededTokens(bucket &b, int needed) {
+    if (needed > b.burst) needed = b.burst;
+    return needed * 1000UL;
+}
+
+bool requestBudget::isBlocked(bucket &b) {
+    if (b.blockLength && millis() - b.blockStart >= b.blockLength) b.blockLength = 0;
+    return b.blockLength != 0;
+}
+
+//
+// Takes one request from the budget. Returns false if the request shouldn't be made. An update that needs more
+// than one request asks for them all with the first, so it isn't left without the later ones.
+//
+bool requestBudget::acquire(int upstream, int needed) {
+    bucket &b = buckets[upstream];
+    if (isBlocked(b)) {
+        b.throttled++;
+        return false;
+    }
+    if (b.perHour) {
+        refill(b);
+        if (b.milliTokens < neededTokens(b, needed)) {
+            b.throttled++;
+            return false;
+        }
+        b.milliTokens -= 1000;
+    }
+    b.requests++;
+    return true;
+}
+
+// The upstream accepted a request, so any backoff starts again from the beginning next time
+void requestBudget::succeeded(int upstream) {
+    buckets[upstream].backoff = 0;
+}
+
+//
+// The upstream replied 429. retryAfter is the number of seconds it asked for, 0 if it didn't say.
+//
+void requestBudget::rateLimited(int upstream, unsigned long retryAfter) {
+    bucket &b = buckets[upstream];
+    b.rateLimited++;
+    if (!retryAfter) {
+        b.backoff = b.backoff ? b.backoff * 2 : BACKOFFSTART;
+        if (b.backoff > BACKOFFMAX) b.backoff = BACKOFFMAX;
+        retryAfter = b.backoff;
+    }
+    b.blockStart = millis();
+    b.blockLength = retryAfter * 1000UL;
+}
+
+//
+// How long (ms) until the needed requests to the upstream would be allowed
+//
+unsigned long requestBudget::getWait(int upstream, int needed) {
+    bucket &b = buckets[upstream];
+    if (isBlocked(b)) return b.blockLength - (millis() - b.blockStart);
+    if (!b.perHour) return 0;
+    refill(b);
+    uint32_t tokens = neededTokens(b, needed);
+    if (b.milliTokens >= tokens) return 0;
+    return (tokens - b.milliTokens) * 3600UL / b.perHour;
+}
+
+String requestBudget::getStats() {
+    String stats = "";
+    for (int i=0;i<UPSTREAMS;i++) {
+        bucket &b = buckets[i];
+        if (b.perHour) refill(b);
+        if (i) stats += F(", ");
+        stats += String(upstreamNames[i]) + F(" ") + String(b.requests) + F(" requests");
+        if (b.perHour) stats += " (" + String(b.milliTokens / 1000) + F(" of ") + String(b.burst) + F(" left, ") + String(b.perHour) + F("/hour)");
+        if (b.throttled) stats += ", " + String(b.throttled) + F(" held back");
+        if (b.rateLimited) stats += ", " + String(b.rateLimited) + F(" rate limited");
+        if (isBlocked(b)) stats += ", backing off " + String(getWait(i) / 1000) + F("s");
+    }
+    return stats;
+}
+
+//
+// Reads the rest of the response headers, returning the seconds asked for by a Retry-After header (0 if there
+// isn't one, or it's given as a date)
+//
+unsigned long requestBudget::readRetryAfter(Stream &client) {
+    unsigned long retryAfter = 0;
+    unsigned long timeout = millis() + 1000UL;
+    while (client.available() && millis() < timeout) {
+        String line = client.readStringUntil('\n');
+        if (line == F("\r")) break;
+        if (line.startsWith(F("Retry-After:")) || line.startsWith(F("retry-after:"))) retryAfter = line.substring(12).toInt();
+    }
+    return retryAfter;
+}
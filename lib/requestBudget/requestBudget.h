@@ -0,0 +1,72 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Request Budget Library - limits how often each upstream API is called and backs off when asked to.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+// Upstream APIs, each with its own budget
+#define UPSTREAM_DARWIN 0
+#define UPSTREAM_TFL 1
+#define UPSTREAM_WEATHER 2
+#define UPSTREAM_GITHUB 3
+#define UPSTREAMS 4
+
+// Default budgets (requests per hour, and how many can be made in a burst). The tokens and keys are shared
+// with other boards, so these are well inside each API's own limits.
+#define DARWINPERHOUR 180
+#define DARWINBURST 6
+#define TFLPERHOUR 480
+#define TFLBURST 8
+#define WEATHERPERHOUR 12
+#define WEATHERBURST 3
+#define GITHUBPERHOUR 10
+#define GITHUBBURST 3
+
+#define BACKOFFSTART 60     // Secs to wait after a 429 without a Retry-After, doubled each time it happens again
+#define BACKOFFMAX 1800
+
+//
+// A token bucket per upstream, refilled continuously at the hourly rate up to the burst size. Clients take a
+// token before each request and don't make it if there isn't one. A 429 (Too Many Requests) blocks the upstream
+// for as long as its Retry-After says, or an increasing backoff if it doesn't say.
+//
+class requestBudget {
+    private:
+        struct bucket {
+            uint16_t perHour;           // 0 for no limit
+            uint16_t burst;
+            uint32_t milliTokens;       // Thousandths of a request
+            unsigned long lastRefill;   // millis()
+            unsigned long blockStart;   // When the last 429 was received
+            unsigned long blockLength;  // ms, 0 if not blocked
+            unsigned long backoff;      // secs
+            unsigned long requests;
+            unsigned long throttled;    // Requests not made because of the budget or a block
+            unsigned long rateLimited;  // 429s received
+        };
+
+        bucket buckets[UPSTREAMS];
+        void refill(bucket &b);
+        uint32_t neededTokens(bucket &b, int needed);
+        bool isBlocked(bucket &b);
+
+    public:
+        requestBudget();
+        void setLimit(int upstream, uint16_t perHour, uint16_t burst);
+        bool acquire(int upstream, int needed = 1);
+        void succeeded(int upstream);
+        void rateLimited(int upstream, unsigned long retryAfter);
+        unsigned long getWait(int upstream, int needed = 1);
+        String getStats();
+        static unsigned long readRetryAfter(Stream &client);
+};
+
+extern requestBudget apiBudget;     // Shared by all of the clients
@@ -0,0 +1,141 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Response Capture Library - keeps the last few data feed responses on the file system for debugging.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <responseCapture.h>
+
+void responseCapture::setEnabled(bool enable) {
+    if (!enable) end();
+    enabled = enable;
+}
+
+bool responseCapture::isEnabled() {
+    return enabled;
+}
+
+void responseCapture::slotPath(int n, bool compressed, char *path) {
+    sprintf(path,"%s/%d.%s",CAPTUREDIR,n,compressed ? "gz" : "txt");
+}
+
+//
+// Reads which slots hold which responses, one line per slot: slot sequence bytes truncated compressed source
+//
+void responseCapture::loadIndex() {
+    indexLoaded = true;
+    File index = LittleFS.open(F(CAPTUREINDEXFILE), "r");
+    if (!index) return;
+    while (index.available()) {
+        String line = index.readStringUntil('\n');
+        int n;
+        unsigned long seq, bytes;
+        int truncated, compressed;
+        char source[MAXCAPTURESOURCESIZE];
+        if (sscanf(line.c_str(),"%d %lu %lu %d %d %11s",&n,&seq,&bytes,&truncated,&compressed,source) != 6 || n < 0 || n >= CAPTURESLOTS) continue;
+        slot[n].sequence = seq;
+        slot[n].bytes = bytes;
+        slot[n].truncated = truncated;
+        slot[n].compressed = compressed;
+        strcpy(slot[n].source,source);
+        if (seq > sequence) sequence = seq;
+    }
+    index.close();
+}
+
+void responseCapture::saveIndex() {
+    File index = LittleFS.open(F(CAPTUREINDEXFILE), "w");
+    if (!index) return;
+    for (int i=0;i<CAPTURESLOTS;i++) {
+        if (slot[i].sequence) index.printf("%d %lu %lu %d %d %s\n",i,(unsigned long)slot[i].sequence,(unsigned long)slot[i].bytes,slot[i].truncated ? 1 : 0,slot[i].compressed ? 1 : 0,slot[i].source);
+    }
+    index.close();
+}
+
+//
+// Starts capturing a response from the given source (a single word), in place of the oldest one kept. It's cut
+// short if the file system is getting full.
+//
+void responseCapture::start(const char *source, bool compressed) {
+    if (!enabled) return;
+    end();
+    if (!indexLoaded) {
+        if (!LittleFS.exists(F(CAPTUREDIR))) LittleFS.mkdir(F(CAPTUREDIR));
+        loadIndex();
+    }
+    int oldest = 0;
+    for (int i=1;i<CAPTURESLOTS;i++) {
+        if (slot[i].sequence < slot[oldest].sequence) oldest = i;
+    }
+    char path[24];
+    if (slot[oldest].sequence) {
+        slotPath(oldest,slot[oldest].compressed,path);
+        LittleFS.remove(path);
+    }
+    size_t freeBytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+    limit = (freeBytes > CAPTUREFREESPACE) ? freeBytes - CAPTUREFREESPACE : 0;
+    if (limit > CAPTUREMAXSIZE) limit = CAPTUREMAXSIZE;
+    slotPath(oldest,compressed,path);
+    file = LittleFS.open(path, "w");
+    if (!file) {
+        slot[oldest] = {};
+        saveIndex();
+        return;
+    }
+    current = oldest;
+    slot[current].sequence = ++sequence;
+    slot[current].bytes = 0;
+    slot[current].truncated = false;
+    slot[current].compressed = compressed;
+    strlcpy(slot[current].source,source,sizeof(slot[0].source));
+}
+
+void responseCapture::write(const char *data, size_t length) {
+    if (current < 0) return;
+    if (slot[current].bytes + length > limit) {
+        length = limit - slot[current].bytes;
+        slot[current].truncated = true;
+    }
+    if (length) slot[current].bytes += file.write((const uint8_t *)data, length);
+}
+
+//
+// Finishes the response being captured, if there is one
+//
+void responseCapture::end() {
+    if (current < 0) return;
+    file.close();
+    current = -1;
+    saveIndex();
+}
+
+//
+// Fills in the responses held, newest first, and returns how many there are. The list must have room for
+// CAPTURESLOTS.
+//
+int responseCapture::getCaptures(captureInfo *list) {
+    if (!indexLoaded) loadIndex();
+    int count = 0;
+    uint32_t newer = UINT32_MAX;
+    while (count < CAPTURESLOTS) {
+        // Next newest of those not listed yet
+        int n = -1;
+        for (int i=0;i<CAPTURESLOTS;i++) {
+            if (slot[i].sequence && slot[i].sequence < newer && (n < 0 || slot[i].sequence > slot[n].sequence)) n = i;
+        }
+        if (n < 0) break;
+        slotPath(n,slot[n].compressed,list[count].path);
+        strcpy(list[count].source,slot[n].source);
+        list[count].bytes = slot[n].bytes;
+        list[count].truncated = slot[n].truncated;
+        list[count].compressed = slot[n].compressed;
+        newer = slot[n].sequence;
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,67 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Response Capture Library - keeps the last few data feed responses on the file system for debugging.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#define CAPTUREDIR "/capture"
+#define CAPTUREINDEXFILE "/capture/index.txt"
+#define CAPTURESLOTS 4              // Responses kept, the oldest is overwritten by the next
+#define CAPTUREMAXSIZE 24576UL      // Bytes kept of each response, anything after is dropped
+#define CAPTUREFREESPACE 32768UL    // File system space always left free, the partition is small
+#define MAXCAPTURESOURCESIZE 12
+
+// A response held on the file system
+struct captureInfo {
+    char path[24];
+    char source[MAXCAPTURESOURCESIZE];
+    uint32_t bytes;
+    bool truncated;
+    bool compressed;    // The body is gzip (the file is .gz)
+};
+
+//
+// Writes the body of each response as it was sent (after any chunked encoding has been removed, but still gzip
+// compressed if it was) into a ring of files, so a bad board can be looked at afterwards and fed through the
+// client again. The data is written straight through from the client's own buffers as it arrives. Nothing is
+// written unless enabled.
+//
+class responseCapture {
+    private:
+        struct captureSlot {
+            uint32_t sequence;      // 0 if the slot hasn't been used
+            uint32_t bytes;
+            bool truncated;
+            bool compressed;
+            char source[MAXCAPTURESOURCESIZE];
+        };
+
+        bool enabled = false;
+        bool indexLoaded = false;
+        captureSlot slot[CAPTURESLOTS] = {};
+        uint32_t sequence = 0;      // Of the most recent capture
+        int current = -1;           // Slot being written
+        uint32_t limit = 0;         // Most that can be written to it
+        File file;
+
+        void loadIndex();
+        void saveIndex();
+        void slotPath(int n, bool compressed, char *path);
+
+    public:
+        void setEnabled(bool enable);
+        bool isEnabled();
+        void start(const char *source, bool compressed);
+        void write(const char *data, size_t length);
+        void end();
+        int getCaptures(captureInfo *list);
+};
@@ -1,6 +1,6 @@
 // Common station data structures shared by both data clients
 #pragma once
-#include <arduino.h>
+#include <Arduino.h>
 
 #define MAXBOARDMESSAGES 4
 #define MAXMESSAGESIZE 400
@@ -19,6 +19,7 @@
 #define UPD_NO_RESPONSE 5
 #define UPD_DATA_ERROR 6
 #define UPD_NO_CHANGE 7
+#define UPD_THROTTLED 8     // Not requested, the upstream's request budget is used up or it asked us to back off
 
 struct stnMessages {
     int numMessages;
@@ -30,6 +31,8 @@ struct rdService {
     char destination[MAXLOCATIONSIZE];
     char via[MAXLOCATIONSIZE];  // also used for line name for TfL
     char etd[11];
+    char sta[6];    // Only for National Rail arrivals - sTime is empty if the service terminates here, and destination holds its origin
+    char eta[11];
     char platform[4];
     bool isCancelled;
     bool isDelayed;
@@ -46,8 +49,17 @@ struct rdService {
     bool platformAvailable;
     int numServices;
     bool boardChanged;  // Only for TfL
+    uint16_t rowChanges;        // Only for National Rail - bit n is set if service[n]'s departure line changed in the last update
+    uint8_t messageChanges;     // Only for National Rail - bit n is set if messages[n] changed
+    bool detailsChanged;        // Only for National Rail - the station name or the first service's calling points, origin etc. changed
     char calling[MAXMESSAGESIZE];   // Only store the calling stops for the first service returned
     char origin[MAXLOCATIONSIZE]; // Only store the origin for the first service returned
     char serviceMessage[MAXMESSAGESIZE];  // Only store the service message for the first service returned
     rdService service[MAXBOARDSERVICES];
   };
+
+  // Everything shown on the board, as filled by one update
+  struct stnBoard {
+    rdStation station;
+    stnMessages messages;
+  };
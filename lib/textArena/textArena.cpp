@@ -0,0 +1,126 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Text Arena Library - variable length text storage that's bump allocated and emptied all at once.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <textArena.h>
+
+textArena::textArena() {
+    highWater = 0;
+    reset();
+}
+
+//
+// Frees all the text. Any handles still held must be cleared before being used again.
+//
+void textArena::reset() {
+    used = 0;
+    overflowed = false;
+}
+
+bool textArena::isTop(const textRef &ref) {
+    return ref.length && ref.offset + ref.length + 1 == used;
+}
+
+const char *textArena::get(const textRef &ref) {
+    return ref.length ? buffer + ref.offset : "";
+}
+
+//
+// Writable access for changes that don't make the text any longer, which must be followed by trim()
+//
+char *textArena::edit(const textRef &ref) {
+    return buffer + ref.offset;
+}
+
+//
+// Updates the length after the text has been shortened through edit(). If it's the top text the space is freed.
+//
+void textArena::trim(textRef &ref) {
+    if (!ref.length) return;
+    bool top = isTop(ref);
+    ref.length = strlen(buffer + ref.offset);
+    if (top) used = ref.length ? ref.offset + ref.length + 1 : ref.offset;
+    if (!ref.length) ref.offset = 0;
+}
+
+void textArena::clear(textRef &ref) {
+    if (isTop(ref)) used = ref.offset;
+    ref.offset = 0;
+    ref.length = 0;
+}
+
+bool textArena::set(textRef &ref, const char *text, size_t maxLength) {
+    clear(ref);
+    return append(ref, text, strlen(text), maxLength);
+}
+
+//
+// Adds length bytes of text to the end of ref, keeping it to no more than maxLength characters. Returns false
+// if any of it had to be dropped.
+//
+bool textArena::append(textRef &ref, const char *text, size_t length, size_t maxLength) {
+    bool complete = true;
+    if (ref.length + length > maxLength) {
+        length = (ref.length < maxLength) ? maxLength - ref.length : 0;
+        complete = false;
+    }
+    if (!length) return complete;
+
+    if (!isTop(ref)) {
+        // Only the top text can grow, so this has to be moved up first
+        if (used + ref.length + 1 > TEXTARENASIZE) {
+            overflowed = true;
+            return false;
+        }
+        memcpy(buffer + used, buffer + ref.offset, ref.length);
+        ref.offset = used;
+        used += ref.length + 1;
+    }
+    if (length > (size_t)(TEXTARENASIZE - used)) {
+        length = TEXTARENASIZE - used;
+        overflowed = true;
+        complete = false;
+    }
+    memcpy(buffer + ref.offset + ref.length, text, length);
+    ref.length += length;
+    used += length;
+    buffer[ref.offset + ref.length] = '\0';
+    if (used > highWater) highWater = used;
+    if (!ref.length) {
+        // Nothing fitted, so give back the terminator
+        used = ref.offset;
+        ref.offset = 0;
+    }
+    return complete;
+}
+
+//
+// The current top of the arena. Releasing back to it frees everything allocated since, so any handles to that
+// text must be cleared.
+//
+uint16_t textArena::mark() {
+    return used;
+}
+
+void textArena::release(uint16_t position) {
+    if (position < used) used = position;
+}
+
+uint16_t textArena::getUsed() {
+    return used;
+}
+
+uint16_t textArena::getHighWater() {
+    return highWater;
+}
+
+bool textArena::hasOverflowed() {
+    return overflowed;
+}
@@ -0,0 +1,56 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Text Arena Library - variable length text storage that's bump allocated and emptied all at once.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef TEXTARENASIZE
+#define TEXTARENASIZE 4096  // Enough for a full board, messages and the calling points of the top few services
+#endif
+
+// Handle to a piece of text in the arena. A zero length handle is empty and takes no space.
+struct textRef {
+    uint16_t offset;
+    uint16_t length;
+};
+
+//
+// Holds the text of one update, each string stored once at the length it actually is instead of in a fixed
+// size field big enough for the longest. Text is allocated from the top of the buffer and everything is freed
+// together by reset(). Each string is kept zero terminated, so get() can be used as a normal C string.
+//
+// Only the most recently allocated text can grow in place. Appending to anything else moves it to the top
+// first, and the space it leaves isn't reused until the next reset().
+//
+class textArena {
+    private:
+        char buffer[TEXTARENASIZE];
+        uint16_t used;
+        uint16_t highWater;     // Most ever used, to show how much headroom there is
+        bool overflowed;        // Some text has been dropped because the arena was full
+
+        bool isTop(const textRef &ref);
+
+    public:
+        textArena();
+        void reset();
+        const char *get(const textRef &ref);
+        char *edit(const textRef &ref);
+        void trim(textRef &ref);
+        void clear(textRef &ref);
+        bool set(textRef &ref, const char *text, size_t maxLength);
+        bool append(textRef &ref, const char *text, size_t length, size_t maxLength);
+        uint16_t mark();
+        void release(uint16_t position);
+        uint16_t getUsed();
+        uint16_t getHighWater();
+        bool hasOverflowed();
+};
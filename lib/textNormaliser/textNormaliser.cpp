@@ -0,0 +1,110 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Text Normaliser Library - tidies message text in a single pass, shared by the National Rail and TfL clients.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <textNormaliser.h>
+
+//
+// The phrases must stay in scope (normally they're string literals). Any too long to match are ignored.
+//
+textNormaliser::textNormaliser(uint8_t options, const char *const *prunePhrases, int count) {
+    this->options = options;
+    memset(special, 0, sizeof(special));
+    setSpecial('\0');
+    if (options & TEXT_MARKUP) setSpecial('<');
+    if (options & TEXT_ENTITIES) setSpecial('&');
+    if (options & TEXT_ESCAPES) setSpecial('\\');
+    if (options & TEXT_SPACES) setSpecial(' ');
+    if (options & TEXT_PRINTABLE) {
+        for (int c=1;c<256;c++) if (!isprint(c)) setSpecial(c);
+    }
+    for (int i=0;i<count && numPhrases<MAXPRUNEPHRASES;i++) {
+        size_t len = strlen(prunePhrases[i]);
+        if (!len || len > MAXPHRASESIZE) continue;
+        const char *p = prunePhrases[i];
+        uint8_t *f = fallback[numPhrases];
+        f[0] = 0;
+        size_t k = 0;
+        for (size_t j=1;j<len;j++) {
+            while (k && p[j] != p[k]) k = f[k-1];
+            if (p[j] == p[k]) k++;
+            f[j] = k;
+        }
+        setSpecial(p[0]);
+        phrase[numPhrases] = p;
+        phraseLength[numPhrases] = len;
+        numPhrases++;
+    }
+}
+
+//
+// Tidies the text according to the options given to the constructor and returns its new length
+//
+size_t textNormaliser::normalise(char *text) {
+    char *p = text;
+    size_t out = 0;     // Never gets ahead of p, so the output can overwrite the input
+    uint8_t matched[MAXPRUNEPHRASES] = {};
+    bool matching = false;      // Whether any phrase is part matched
+    bool pruned = false;
+
+    while (*p && !pruned) {
+        if (!matching) {
+            while (!isSpecial(*p)) text[out++] = *p++;
+            if (!*p) break;
+        }
+        char c = *p;
+        if (c == '<' && (options & TEXT_MARKUP)) {
+            char *tagEnd = strchr(p, '>');
+            if (!tagEnd) break;     // Unterminated tag, drop the rest
+            bool lineBreak = (p[1] == 'b' || p[1] == 'B') && (p[2] == 'r' || p[2] == 'R') && (p[3] == '>' || p[3] == '/' || p[3] == ' ');
+            p = tagEnd + 1;
+            if (!lineBreak) continue;
+            c = ' ';
+        } else if (c == '&' && (options & TEXT_ENTITIES) && strncmp(p, "&amp;", 5) == 0) {
+            c = '&';
+            p += 5;
+        } else if (c == '&' && (options & TEXT_ENTITIES) && strncmp(p, "&quot;", 6) == 0) {
+            c = '\"';
+            p += 6;
+        } else if (c == '\\' && (options & TEXT_ESCAPES) && p[1] == 'n') {
+            p += 2;
+            continue;
+        } else if ((options & TEXT_PRINTABLE) && !isprint((unsigned char)c)) {
+            p++;
+            continue;
+        } else {
+            p++;
+        }
+
+        if (c == ' ' && (options & TEXT_SPACES) && (!out || text[out-1] == ' ')) continue;
+        text[out++] = c;
+
+        // Follow each phrase along the output, cutting it off where the first one ends up complete
+        matching = false;
+        for (int i=0;i<numPhrases;i++) {
+            uint8_t m = matched[i];
+            while (m && phrase[i][m] != c) m = fallback[i][m-1];
+            if (phrase[i][m] == c) m++;
+            if (m == phraseLength[i]) {
+                out -= m;
+                pruned = true;
+                break;
+            }
+            matched[i] = m;
+            if (m) matching = true;
+        }
+    }
+
+    if (options & TEXT_TRIMEND) {
+        while (out && (text[out-1] == '.' || text[out-1] == ' ')) out--;
+    }
+    text[out] = '\0';
+    return out;
+}
@@ -0,0 +1,48 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Text Normaliser Library - tidies message text in a single pass, shared by the National Rail and TfL clients.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+// What normalise() does to the text
+#define TEXT_MARKUP     0x01    // Remove HTML tags, a line break becomes a space
+#define TEXT_ENTITIES   0x02    // Decode the HTML-escaped ampersands and quotes left in the text
+#define TEXT_PRINTABLE  0x04    // Remove non-printing characters
+#define TEXT_SPACES     0x08    // Collapse runs of spaces into one and drop any leading spaces
+#define TEXT_ESCAPES    0x10    // Remove \n escapes left in the text
+#define TEXT_TRIMEND    0x20    // Remove trailing spaces and fullstops
+#define TEXT_MESSAGE    (TEXT_MARKUP | TEXT_ENTITIES | TEXT_PRINTABLE | TEXT_SPACES | TEXT_TRIMEND)
+
+#define MAXPRUNEPHRASES 4       // Phrases the text can be cut short at
+#define MAXPHRASESIZE 24
+
+//
+// Rewrites text in place, never making it any longer, in one forward pass over the input. The text can also be
+// cut short at the first of a few phrases, which are looked for in the output as it's written. Each phrase has
+// a KMP style table of where to carry on matching from after a mismatch, so no character is looked at twice.
+// Runs of characters that are left as they are, and can't start a phrase, are copied without the checks.
+//
+class textNormaliser {
+    private:
+        uint8_t options;
+        int numPhrases = 0;
+        const char *phrase[MAXPRUNEPHRASES];
+        uint8_t phraseLength[MAXPRUNEPHRASES];
+        uint8_t fallback[MAXPRUNEPHRASES][MAXPHRASESIZE];  // Length of the longest proper prefix that's also a suffix
+        uint8_t special[32];    // A bit for each character that needs more than copying, while no phrase is part matched
+
+        void setSpecial(unsigned char c) { special[c >> 3] |= 1 << (c & 7); }
+        bool isSpecial(unsigned char c) const { return special[c >> 3] & (1 << (c & 7)); }
+
+    public:
+        textNormaliser(uint8_t options, const char *const *prunePhrases = nullptr, int count = 0);
+        size_t normalise(char *text);
+};
@@ -12,6 +12,9 @@
 #include <weatherClient.h>
 #include <JsonListener.h>
 #include <WiFiClient.h>
+#include <httpChunkDecoder.h>
+#include <httpInflater.h>
+#include <requestBudget.h>
 
 weatherClient::weatherClient() {}
 
@@ -22,6 +25,12 @@ bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
     JsonStreamingParser parser;
     parser.setListener(this);
     WiFiClient httpClient;
+    httpInflater inflater;
+
+    if (!apiBudget.acquire(UPSTREAM_WEATHER)) {
+        lastErrorMsg += F("Request budget used up");
+        return false;
+    }
 
     int retryCounter=0;
     while (!httpClient.connect(apiHost, 80) && (retryCounter++ < 15)){
@@ -32,7 +41,9 @@ bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
         return false;
     }
 
-    String request = "GET /data/2.5/weather?units=metric&lang=en&lat=" + lat + F("&lon=") + lon + F("&appid=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\nConnection: close\r\n\r\n");
+    String request = "GET /data/2.5/weather?units=metric&lang=en&lat=" + lat + F("&lon=") + lon + F("&appid=") + apiKey + F(" HTTP/1.0\r\nHost: ") + String(apiHost) + F("\r\n");
+    if (inflater.begin()) request += F("Accept-Encoding: gzip\r\n");
+    request += F("Connection: close\r\n\r\n");
     httpClient.print(request);
     retryCounter=0;
     while(!httpClient.available() && retryCounter++ < 40) {
@@ -49,6 +60,7 @@ bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
     // Parse status code
     String statusLine = httpClient.readStringUntil('\n');
     if (!statusLine.startsWith(F("HTTP/")) || statusLine.indexOf(F("200 OK")) == -1) {
+        if (statusLine.indexOf(F(" 429")) > 0) apiBudget.rateLimited(UPSTREAM_WEATHER,requestBudget::readRetryAfter(httpClient));
         httpClient.stop();
 
         if (statusLine.indexOf(F("401")) > 0) {
@@ -60,27 +72,50 @@ bool weatherClient::updateWeather(String apiKey, String lat, String lon) {
         }
         return false;
     }
+    apiBudget.succeeded(UPSTREAM_WEATHER);
 
     // Skip the remaining headers
+    bool bChunked = false;
+    uint8_t contentEncoding = ENCODING_IDENTITY;
     while (httpClient.connected() || httpClient.available()) {
         String line = httpClient.readStringUntil('\n');
         if (line == "\r") break;
+        if (line.startsWith(F("Transfer-Encoding:")) && line.indexOf(F("chunked")) >= 0) bChunked=true;
+        else if (line.startsWith(F("Content-Encoding:"))) contentEncoding = httpInflater::parseEncoding(line.substring(17));
+    }
+    if (!inflater.reset(contentEncoding)) {
+        httpClient.stop();
+        lastErrorMsg = F("Unsupported Content-Encoding");
+        return false;
     }
 
     bool isBody = false;
-    char c;
     weatherItem=0;
+    httpChunkDecoder dechunker;
+    dechunker.reset(bChunked);
+    lastBytesReceived = 0;
 
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpClient.available() || httpClient.connected()) && (millis() < dataSendTimeout)) {
         while(httpClient.available()) {
-            c = httpClient.read();
-            if (c == '{' || c == '[') isBody = true;
-            if (isBody) parser.parse(c);
+            int bytesRead = httpClient.read((uint8_t *)readBuffer, sizeof(readBuffer));
+            if (bytesRead <= 0) break;
+            lastBytesReceived += bytesRead;
+            inflater.write(readBuffer, dechunker.filter(readBuffer, bytesRead));   // Chunk framing isn't part of the body
+            char *json;
+            size_t jsonBytes;
+            while ((jsonBytes = inflater.read(&json)) > 0) {
+                for (size_t i=0;i<jsonBytes;i++) {
+                    if (json[i] == '{' || json[i] == '[') isBody = true;
+                    if (isBody) parser.parse(json[i]);
+                }
+            }
         }
         delay(5);
     }
     httpClient.stop();
+    lastBytesDecoded = inflater.getBytesOut();
+    lastCompressed = inflater.isCompressed();
     if (millis() >= dataSendTimeout) {
         lastErrorMsg += F("Data timeout");
         return false;
@@ -12,6 +12,8 @@
 #include <JsonListener.h>
 #include <JsonStreamingParser.h>
 
+#define WEATHERREADBUFFERSIZE 256
+
 class weatherClient: public JsonListener {
 
     private:
@@ -23,10 +25,14 @@ class weatherClient: public JsonListener {
         String description;
         float temperature;
         float windSpeed;
+        char readBuffer[WEATHERREADBUFFERSIZE];
 
     public:
         String currentWeather = "";
         String lastErrorMsg = "";
+        long lastBytesReceived = 0;     // Size of the last response as sent, and once inflated
+        uint32_t lastBytesDecoded = 0;
+        bool lastCompressed = false;
 
         weatherClient();
 
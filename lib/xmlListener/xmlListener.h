@@ -12,14 +12,43 @@
 #pragma once
 #include <Arduino.h>
 
+#define XML_MAX_DEPTH 12    // Number of nested elements whose tag ids are tracked
+#define XML_TAG_UNKNOWN 0   // Id reported for tags that aren't in the parser's tag table
+#define XML_NS_UNKNOWN 0    // Id reported for elements in a namespace that isn't in the parser's namespace table
+
+#define XML_CONTINUE 0      // startTag() result - parse the element's contents as normal
+#define XML_SKIP 1          // startTag() result - skip the element's contents, only its endTag() is reported
+#define XML_STOP 2          // startTag()/endTag() result - the listener has everything it needs, ignore the rest of the document
+
+// The (namespace id, local name id) pairs of the currently open elements, outermost first
+struct xmlTagStack {
+    int depth;                  // Current element depth (can exceed XML_MAX_DEPTH)
+    uint8_t id[XML_MAX_DEPTH];
+    uint8_t ns[XML_MAX_DEPTH];
+
+    // Tag id at the given level (1 = outermost element), or XML_TAG_UNKNOWN if not tracked
+    uint8_t at(int level) const { return (level > 0 && level <= depth && level <= XML_MAX_DEPTH) ? id[level-1] : XML_TAG_UNKNOWN; }
+    uint8_t current() const { return at(depth); }
+    uint8_t parent() const { return at(depth-1); }
+    uint8_t grandParent() const { return at(depth-2); }
+
+    // Namespace id at the given level, or XML_NS_UNKNOWN if not tracked
+    uint8_t nsAt(int level) const { return (level > 0 && level <= depth && level <= XML_MAX_DEPTH) ? ns[level-1] : XML_NS_UNKNOWN; }
+    uint8_t currentNs() const { return nsAt(depth); }
+};
+
 class xmlListener {
   private:
 
   public:
     
-    virtual void startTag(const char *tagName) = 0;
-    virtual void endTag(const char *tagName) = 0;
+    // An element's attributes are reported before its startTag(), which comes once the whole start tag
+    // has been read so that the namespace ids on the tag stack include the element's own declarations.
+    virtual int startTag(const char *tagName, const xmlTagStack &tags) = 0;
+    virtual int endTag(const char *tagName, const xmlTagStack &tags) = 0;
     virtual void parameter(const char *param) = 0;
-    virtual void value(const char *value) = 0;
-    virtual void attribute(const char *attribute) = 0; 
+    // Element text, in one or more chunks (each NUL terminated) with last set on the final one
+    virtual void valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags) = 0;
+    // Attribute of the current element, with the value unquoted and decoded
+    virtual void attribute(const char *name, const char *value, const xmlTagStack &tags) = 0;
 };
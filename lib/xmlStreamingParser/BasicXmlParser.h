@@ -0,0 +1,1059 @@
+/*
+ * XML Streaming Parser Library - parser template
+ *  - based on the structure of samxl embedded XML parser by Zorxx Software at https://github.com/zorxx/saxml
+ * 
+ * MIT License
+ *
+ * Copyright (c) 2025 Gadec Software
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <xmlListener.h>
+
+#define XML_FALLTHROUGH  __attribute__((__fallthrough__))
+
+#define XML_BUFFER_MAX_LENGTH 128   // Longest tag name or attribute (element text is passed on in chunks of up to this size)
+#define XML_MAX_NS_BINDINGS 16      // Number of xmlns declarations that can be in scope at once
+#define XML_PREFIX_MAX_LENGTH 12    // Longest namespace prefix that can be resolved (including terminator)
+#define XML_NAME_MAX_LENGTH 48      // Longest element name held while its attributes are parsed (including terminator)
+#define XML_ENTITY_MAX_LENGTH 10    // Longest character reference that will be decoded, e.g. "#x1F600" (including terminator)
+
+#define STATE_NULL 0
+#define STATE_BEGIN 1
+#define STATE_STARTTAG 2
+#define STATE_TAGNAME 3
+#define STATE_TAGCONTENTS 4
+#define STATE_ENDTAG 5
+#define STATE_EMPTYTAG 6
+#define STATE_ATTRIBUTE 7
+#define STATE_SKIP 8
+#define STATE_MARKUP 9
+
+#define SKIP_TEXT 0         // Sub-states while skipping a subtree
+#define SKIP_TAGSTART 1
+#define SKIP_TAG 2
+
+/* Compile time checks that a tag table built from string literals is in strcmp() order, for use in a static_assert */
+constexpr int xmlCompareNames(const char *a, const char *b) {
+    return (*a && *a == *b) ? xmlCompareNames(a + 1, b + 1) : (int)(unsigned char)*a - (int)(unsigned char)*b;
+}
+constexpr bool xmlTableSorted(const char * const *table, int size) {
+    return size < 2 || (xmlCompareNames(table[0], table[1]) < 0 && xmlTableSorted(table + 1, size - 1));
+}
+
+//
+// The parser itself, with the listener type as a template parameter so that calls to the listener's
+// startTag/endTag/valueChunk/attribute handlers are resolved at compile time and can be inlined. Any class
+// with handlers matching those in xmlListener can be used as the Listener (they needn't be virtual or
+// public - a listener can make the parser a friend). xmlStreamingParser is the instantiation for
+// listeners derived from xmlListener.
+//
+template<class Listener>
+class BasicXmlParser {
+  private:
+
+    // A namespace prefix declared by an xmlns attribute, in scope until the declaring element closes
+    struct nsBinding {
+      char prefix[XML_PREFIX_MAX_LENGTH];   // Empty for the default namespace
+      uint8_t ns;
+      int depth;
+    };
+
+    int state;
+    int nextState;
+    Listener* myListener;
+    const char * const *tagTable = nullptr;
+    uint8_t tagTableSize = 0;
+    xmlTagStack tags;
+    const char * const *nsTable = nullptr;
+    uint8_t nsTableSize = 0;
+    nsBinding nsBindings[XML_MAX_NS_BINDINGS];
+    int nsBindingCount;
+    char tagPrefix[XML_PREFIX_MAX_LENGTH];  // Prefix of the most recently started element
+    bool tagPrefixValid;                    // False if that prefix was too long to store
+    char tagName[XML_NAME_MAX_LENGTH];      // Name of the element whose start tag is being parsed
+
+    char buffer[XML_BUFFER_MAX_LENGTH];
+    char entity[XML_ENTITY_MAX_LENGTH];     // Character reference being collected, without the '&' and ';'
+    uint8_t entityLength;
+    bool inEntity;
+    bool valueStarted;                      // Some of the current element's text has been buffered
+
+    int skipDepth;          // Open elements in the subtree being skipped, including its root
+    uint8_t skipState;
+    char skipQuote;         // Quote character if inside an attribute value, otherwise 0
+    char skipLast;          // Previous character within the current tag
+    bool skipClosing;       // Current tag is an end tag
+    bool skipMarkup;        // Current tag is a comment, declaration or processing instruction
+
+    char markupType;        // '?' for a declaration or processing instruction, '!' for a comment or DOCTYPE
+    uint8_t markupLength;   // Characters seen since the '<' (stops counting once it's a known comment)
+    uint8_t markupDashes;   // Consecutive '-' characters just seen
+    bool markupComment;
+
+    uint8_t nameHash[XML_MAX_DEPTH];    // Hash of each open element's name, to match against its end tag
+    bool rootClosed;        // The document element has been closed
+    bool stopped;           // The listener asked for the rest of the document to be ignored
+    long position;          // Offset in the document of the character being parsed
+    long errorPosition;     // Offset of the first well-formedness error, or -1
+
+    bool bInitialize;   // True for the first call into a state
+    char attrQuote = 0;     // Quote character if we're inside a quoted attribute value, otherwise 0
+    uint32_t length;
+
+    void state_Begin(const char character);
+    void state_StartTag(const char character);
+    void state_TagName(const char character);
+    void state_EmptyTag(const char character);
+    void state_TagContents(const char character);
+    void state_Attribute(const char character);
+    void state_Skip(const char character);
+    void state_EndTag(const char character);
+    void state_Markup(const char character);
+    void step(const char character);
+    const char *scan_Begin(const char *buf, const char *end);
+    const char *scan_TagContents(const char *buf, const char *end);
+    const char *scan_Skip(const char *buf, const char *end);
+    uint8_t LookupTag(const char *tagName);
+    uint8_t LookupNamespace(const char *uri, size_t length);
+    uint8_t ResolvePrefix(const char *prefix);
+    void NamespaceAttribute(const char *name, const char *value);
+    void Attribute();
+    void DecodeAttributeValue(char *value);
+    void StartTag();
+    int ReportStartTag();
+    void BeginSkip();
+    void EndTag();
+    void ContextBufferAddChar(const char character);
+    void ValueAddChar(const char character);
+    static int DecodeCodePoint(uint32_t codePoint, char *out);
+    static int DecodeReference(const char *name, char *out);
+    void FlushEntity();
+    void DecodeEntity();
+    void ChangeState(int newState);
+    static uint8_t NameHash(const char *name);
+    void SyntaxError();
+
+  public:
+    BasicXmlParser();
+    void parse(const char character);
+    void parse(const char *buf, size_t len);
+    void setListener(Listener* listener);
+    void setTagTable(const char * const *table, uint8_t size);
+    void setNamespaceTable(const char * const *table, uint8_t size);
+    void reset();
+    bool isDocumentComplete();
+    bool isStopped();
+    long getErrorPosition();
+
+};
+
+template<class Listener>
+BasicXmlParser<Listener>::BasicXmlParser() {
+    reset();
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::setListener(Listener* listener) {
+    myListener = listener;
+}
+
+/* Set the table of known tag local names (the part after any namespace prefix). Tags are reported
+ *  to the listener as their (1-based) index in this table, or XML_TAG_UNKNOWN. The table must be
+ *  sorted in strcmp() order. */
+template<class Listener>
+void BasicXmlParser<Listener>::setTagTable(const char * const *table, uint8_t size) {
+    tagTable = table;
+    tagTableSize = size;
+}
+
+/* Set the table of known namespaces. Each entry must match the URI in an xmlns declaration exactly,
+ *  unless it ends in '*' in which case it matches any URI starting with the text before the '*' (so
+ *  version-specific URIs can share an entry). The first match gives the (1-based) namespace id
+ *  reported for elements in that namespace, or XML_NS_UNKNOWN. */
+template<class Listener>
+void BasicXmlParser<Listener>::setNamespaceTable(const char * const *table, uint8_t size) {
+    nsTable = table;
+    nsTableSize = size;
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::reset() {
+    attrQuote=0;
+    tags.depth=0;
+    nsBindingCount=0;
+    tagPrefix[0]='\0';
+    tagPrefixValid=true;
+    inEntity=false;
+    valueStarted=false;
+    rootClosed=false;
+    stopped=false;
+    position=0;
+    errorPosition=-1;
+    ChangeState(STATE_BEGIN);
+}
+
+/* True once the document element has been closed (or the listener has stopped the parse, having read
+ *  all it needs) with no well-formedness errors found on the way. A response that stops part way
+ *  through (a dropped connection or a timeout) never gets here. */
+template<class Listener>
+bool BasicXmlParser<Listener>::isDocumentComplete() {
+    return (rootClosed || stopped) && errorPosition < 0;
+}
+
+/* True if the listener returned XML_STOP - any further input is ignored, so the caller can stop reading */
+template<class Listener>
+bool BasicXmlParser<Listener>::isStopped() {
+    return stopped;
+}
+
+/* Offset of the first well-formedness error in the document, or -1 if there hasn't been one */
+template<class Listener>
+long BasicXmlParser<Listener>::getErrorPosition() {
+    return errorPosition;
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::parse(const char character) {
+    step(character);
+    position++;
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::step(const char character) {
+    if (stopped) return;
+
+    switch (state) {
+        case STATE_BEGIN:
+            state_Begin(character);
+            break;
+        case STATE_STARTTAG:
+            state_StartTag(character);
+            break;
+        case STATE_TAGNAME:
+            state_TagName(character);
+            break;
+        case STATE_TAGCONTENTS:
+            state_TagContents(character);
+            break;
+        case STATE_ENDTAG:
+            state_EndTag(character);
+            break;
+        case STATE_EMPTYTAG:
+            state_EmptyTag(character);
+            break;
+        case STATE_ATTRIBUTE:
+            state_Attribute(character);
+            break;
+        case STATE_SKIP:
+            state_Skip(character);
+            break;
+        case STATE_MARKUP:
+            state_Markup(character);
+            break;
+        default:
+            break;
+    }
+}
+
+/* Bulk entry point. The tag markup itself is handed to the per-character state machine, but runs
+ *  of text between tags (and anything before the first tag) are scanned with memchr and copied in
+ *  a single operation. The events emitted are identical to feeding the same bytes to parse(char). */
+template<class Listener>
+void BasicXmlParser<Listener>::parse(const char *buf, size_t len) {
+    const char *start = buf;
+    const char *end = buf + len;
+    long base = position;
+
+    while (buf < end && !stopped) {
+        position = base + (buf - start);
+        switch (state) {
+            case STATE_BEGIN:
+                buf = scan_Begin(buf, end);
+                break;
+            case STATE_TAGCONTENTS:
+                buf = scan_TagContents(buf, end);
+                break;
+            case STATE_SKIP:
+                buf = scan_Skip(buf, end);
+                break;
+            default:
+                step(*buf++);
+                break;
+        }
+    }
+    position = base + len;
+}
+
+/* Bulk equivalent of state_Begin - skip everything up to the first tag start character */
+template<class Listener>
+const char *BasicXmlParser<Listener>::scan_Begin(const char *buf, const char *end) {
+
+    if (bInitialize) {
+        length=0;
+        buffer[length] = '\0';
+        bInitialize=false;
+    }
+
+    const char *tagStart = (const char *)memchr(buf, '<', end - buf);
+    if (!tagStart) return end;
+
+    ChangeState(STATE_STARTTAG);
+    return tagStart + 1;
+}
+
+/* Bulk equivalent of state_TagContents - copy the text up to the next tag start or character
+ *  reference into the buffer, passing it to the listener in chunks if it won't fit. References
+ *  are decoded by the per-character state. */
+template<class Listener>
+const char *BasicXmlParser<Listener>::scan_TagContents(const char *buf, const char *end) {
+
+    if(bInitialize)
+    {
+        length = 0;
+        buffer[length] = '\0';
+        inEntity = false;
+        valueStarted = false;
+        bInitialize = false;
+    }
+
+    /* Finish any character reference that was split across buffers */
+    while (inEntity && buf < end && state == STATE_TAGCONTENTS) state_TagContents(*buf++);
+    if (buf == end || state != STATE_TAGCONTENTS) return buf;
+
+    const char *tagStart = (const char *)memchr(buf, '<', end - buf);
+    const char *textEnd = tagStart ? tagStart : end;
+    const char *reference = (const char *)memchr(buf, '&', textEnd - buf);
+    if (reference) textEnd = reference;
+
+    if (!valueStarted) {
+        /* Ignore leading whitespace */
+        while (buf < textEnd && (*buf == ' ' || *buf == '\r' || *buf == '\n' || *buf == '\t')) buf++;
+    }
+
+    while (buf < textEnd) {
+        if (length >= sizeof(buffer)-1) {
+            /* Buffer full, pass on what we have so far */
+            myListener->valueChunk(buffer, length, false, tags);
+            length = 0;
+        }
+        size_t count = textEnd - buf;
+        if (count > sizeof(buffer)-1-length) count = sizeof(buffer)-1-length;
+        memcpy(buffer + length, buf, count);
+        length += count;
+        buffer[length] = '\0';
+        buf += count;
+        valueStarted = true;
+    }
+
+    if (reference) {
+        state_TagContents('&');
+        return reference + 1;
+    }
+    if (!tagStart) return end;
+
+    if (valueStarted) myListener->valueChunk(buffer, length, true, tags);
+    ChangeState(STATE_STARTTAG);
+    return tagStart + 1;
+}
+
+/* Bulk equivalent of state_Skip - jump straight to the next tag when between tags, and to the
+ *  next '>' or quote when within one */
+template<class Listener>
+const char *BasicXmlParser<Listener>::scan_Skip(const char *buf, const char *end) {
+
+    if (skipState == SKIP_TEXT) {
+        const char *tagStart = (const char *)memchr(buf, '<', end - buf);
+        if (!tagStart) return end;
+        skipState = SKIP_TAGSTART;
+        return tagStart + 1;
+    }
+
+    if (skipState == SKIP_TAG && !skipQuote) {
+        const char *stop = (const char *)memchr(buf, '>', end - buf);
+        if (!stop) stop = end;
+        if (!skipMarkup) {
+            const char *quote = (const char *)memchr(buf, '\"', stop - buf);
+            if (quote) stop = quote;
+            quote = (const char *)memchr(buf, '\'', stop - buf);
+            if (quote) stop = quote;
+        }
+        if (stop > buf) {
+            skipLast = stop[-1];
+            return stop;
+        }
+    }
+
+    state_Skip(*buf);
+    return buf + 1;
+}
+
+/* Wait for a tag start character */
+template<class Listener>
+void BasicXmlParser<Listener>::state_Begin(const char character) {
+
+    if (bInitialize) {
+        length=0;
+        buffer[length] = '\0';
+        bInitialize=false;
+    }
+
+    switch (character)
+    {
+        case '<':
+            ChangeState(STATE_STARTTAG);
+            break;
+        default:
+            break;
+    }
+}
+
+/* We've already found a tag start character, determine if this is start or end tag,
+ *  and parse the tag name */
+template<class Listener>
+void BasicXmlParser<Listener>::state_StartTag(const char character) {
+
+    if (bInitialize) bInitialize=false;
+
+    switch(character)
+    {
+        case '<': case '>':
+            /* Syntax error! */
+            SyntaxError();
+            break;
+        case ' ': case '\r': case '\n': case '\t':
+            /* Ignore whitespace */
+            break;
+        case '/':
+            ChangeState(STATE_ENDTAG);
+            break;
+        case '?': case '!':
+            markupType = character;
+            ChangeState(STATE_MARKUP);
+            break;
+        default:
+            buffer[0] = character;
+            length = 1;
+            buffer[length] = '\0';
+            ChangeState(STATE_TAGNAME);
+            break;
+    }
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::state_TagName(const char character) {
+
+    nextState = STATE_NULL;
+    if(bInitialize)
+    {
+        /* Expect one character in the buffer; the start of the tag name from the previous state*/
+        bInitialize = false;
+    }
+
+    switch(character)
+    {
+        case ' ': case '\r': case '\n': case '\t':
+            /* Tag name complete, whitespace indicates tag attribute */
+            nextState = STATE_ATTRIBUTE;
+            break;
+        case '/':
+            nextState = STATE_EMPTYTAG;    // workaround for urls
+            break;
+        case '>':
+            nextState = STATE_TAGCONTENTS;
+            /* Done with tag, contents may follow */
+            break;
+        case '<':
+            /* Syntax error! */
+            SyntaxError();
+            break;
+        default:
+            ContextBufferAddChar(character);
+            break;
+    }
+
+    if(nextState != STATE_NULL)
+    {
+        if (length>0) {
+            length++;
+            StartTag();
+            if (nextState != STATE_ATTRIBUTE && ReportStartTag() == XML_SKIP && nextState != STATE_EMPTYTAG) {
+                BeginSkip();
+                return;
+            }
+        }
+        ChangeState(nextState);
+    }
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::state_EmptyTag(const char character) {
+    nextState = STATE_NULL;
+
+    if(bInitialize)
+    {
+        /* We need to keep the buffer as-is, since it contains the tag name */
+        bInitialize = false;
+    }
+
+    switch(character)
+    {
+        case '>':
+            nextState = STATE_TAGCONTENTS;
+            break;
+        default:
+            break;
+    }
+
+    if(nextState != STATE_NULL)
+    {
+        if (length>0) { length++; EndTag(); }
+        ChangeState(nextState);
+    }
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::state_TagContents(const char character) {
+    nextState = STATE_NULL;
+
+    if(bInitialize)
+    {
+        length = 0;
+        buffer[length] = '\0';
+        inEntity = false;
+        valueStarted = false;
+        bInitialize = false;
+    }
+
+    if (inEntity) {
+        if (character == ';') {
+            DecodeEntity();
+            return;
+        }
+        if (character != '<' && character != '&' && character != ' ' && character != '\r' && character != '\n' && character != '\t' && entityLength < sizeof(entity)-1) {
+            entity[entityLength++] = character;
+            return;
+        }
+        /* Not a character reference after all, keep the text as it was */
+        FlushEntity();
+    }
+
+    switch(character)
+    {
+        case '<':
+            nextState = STATE_STARTTAG;
+            break;
+        case '&':
+            inEntity = true;
+            entityLength = 0;
+            break;
+        case ' ': case '\r': case '\n': case '\t':
+            if(!valueStarted)
+                break; /* Ignore leading whitespace */
+            else
+            {
+                // Fallthrough
+                XML_FALLTHROUGH;
+            }
+        default:
+            ValueAddChar(character);
+            break;
+    }
+
+    if(nextState != STATE_NULL)
+    {
+        if (valueStarted) myListener->valueChunk(buffer, length, true, tags);
+        ChangeState(nextState);
+    }
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::state_Attribute(const char character) {
+    nextState = STATE_NULL;
+
+    if(bInitialize)
+    {
+        length = 0;
+        buffer[length] = '\0';
+        bInitialize = false;
+    }
+
+    switch(character)
+    {
+        case ' ': case '\r': case '\n': case '\t':
+            if (attrQuote)
+                ContextBufferAddChar(character);
+            else if(length != 0)
+                nextState = STATE_ATTRIBUTE;
+            break;
+        case '\"': case '\'':
+            if (!attrQuote) attrQuote = character;
+            else if (attrQuote == character) attrQuote = 0;
+            ContextBufferAddChar(character);
+            break;
+        case '/':
+            if (attrQuote) {
+                ContextBufferAddChar('/');
+            } else {
+                /* Handle the case where an attribute is included in an empty tag,
+                and the attribute name/value has no trailing whitespace
+                prior to the empty tag terminator. */
+                if (length > 0) {
+                    Attribute();
+                    length = 0;
+                    buffer[length] = '\0';
+                }
+                ReportStartTag();
+                /* We've found an empty tag that contains at least one attribute.
+                Since the buffer containing the tag name is long-gone (the attribute
+                is now in the parser's string buffer), we don't have a way to get it
+                back. In order to generate a "tagEnd" event, store a dummy string
+                containing a single space character (which isn't a valid tag name),
+                which will be provided to the tagEndHandler callback. */
+                ContextBufferAddChar(' ');
+                nextState = STATE_EMPTYTAG;
+            }
+            break;
+        case '>':
+            if (attrQuote) ContextBufferAddChar(character);
+            else nextState = STATE_TAGCONTENTS; /* Done with tag, contents may follow */
+            break;
+        case '<':
+            if (!attrQuote) SyntaxError();
+            ContextBufferAddChar(character);
+            break;
+        default:
+            ContextBufferAddChar(character);
+            break;
+    }
+
+    if(nextState != STATE_NULL)
+    {
+        if(nextState != STATE_EMPTYTAG)
+        {
+            if (length>0) { attrQuote=0; Attribute(); }
+            if (nextState == STATE_TAGCONTENTS && ReportStartTag() == XML_SKIP) {
+                BeginSkip();
+                return;
+            }
+        }
+        ChangeState(nextState);
+    }
+}
+
+/* Skipping a subtree at the listener's request. Only enough of the markup is tracked to find the
+ *  end of the element the skip started on - nothing is buffered and the listener isn't called. */
+template<class Listener>
+void BasicXmlParser<Listener>::state_Skip(const char character) {
+
+    if (bInitialize) bInitialize=false;
+
+    switch (skipState)
+    {
+        case SKIP_TEXT:
+            if (character == '<') skipState = SKIP_TAGSTART;
+            break;
+        case SKIP_TAGSTART:
+            skipClosing = (character == '/');
+            skipMarkup = (character == '!' || character == '?');
+            if (!skipClosing && !skipMarkup) skipDepth++;
+            skipQuote = 0;
+            skipLast = character;
+            skipState = SKIP_TAG;
+            break;
+        case SKIP_TAG:
+            if (skipQuote) {
+                if (character == skipQuote) skipQuote = 0;
+            } else if ((character == '\"' || character == '\'') && !skipMarkup) {
+                skipQuote = character;
+            } else if (character == '>') {
+                if (skipClosing || (skipLast == '/' && !skipMarkup)) skipDepth--;
+                skipState = SKIP_TEXT;
+                if (skipDepth == 0) {
+                    /* The buffer still holds the skipped element's name */
+                    EndTag();
+                    ChangeState(STATE_TAGCONTENTS);
+                }
+                break;
+            }
+            skipLast = character;
+            break;
+    }
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::state_EndTag(const char character) {
+    
+    nextState=STATE_NULL;
+
+    if(bInitialize)
+    {
+        length = 0;
+        buffer[length] = '\0';
+        bInitialize = false;
+    }
+
+    switch(character)
+    {
+        case '<':
+            /* Syntax error! */
+            SyntaxError();
+            break;
+        case ' ': case '\r': case '\n': case '\t':
+            /* Ignore whitespace */
+            break;
+        case '>':
+            nextState = STATE_TAGCONTENTS;
+            break;
+        default:
+            ContextBufferAddChar(character);
+            break;
+    }
+
+    if(nextState != STATE_NULL)
+    {
+        if (length>0) { length++; EndTag(); }
+        ChangeState(nextState);
+    }
+}
+
+/* Inside an XML declaration, processing instruction, comment or DOCTYPE. None of these are reported to
+ *  the listener or counted as elements - we just look for the end of the markup. */
+template<class Listener>
+void BasicXmlParser<Listener>::state_Markup(const char character) {
+
+    if (bInitialize) {
+        markupLength = 1;   // The '?' or '!'
+        markupDashes = 0;
+        markupComment = false;
+        bInitialize = false;
+    }
+
+    if (!markupComment && markupLength < 255) markupLength++;
+    if (character == '-') {
+        if (markupDashes < 2) markupDashes++;
+        if (!markupComment && markupType == '!' && markupLength == 3 && markupDashes == 2) {
+            /* "<!--" - a comment, which runs until "-->" */
+            markupComment = true;
+            markupDashes = 0;
+        }
+        return;
+    }
+
+    if (character == '>' && (!markupComment || markupDashes == 2)) {
+        ChangeState(tags.depth ? STATE_TAGCONTENTS : STATE_BEGIN);
+        return;
+    }
+    markupDashes = 0;
+}
+
+/* Binary search the tag table for the tag name */
+template<class Listener>
+uint8_t BasicXmlParser<Listener>::LookupTag(const char *tagName) {
+    int low = 0;
+    int high = tagTableSize - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = strcmp(tagName, tagTable[mid]);
+        if (cmp == 0) return mid + 1;
+        if (cmp < 0) high = mid - 1; else low = mid + 1;
+    }
+    return XML_TAG_UNKNOWN;
+}
+
+/* Match a namespace URI against the namespace table */
+template<class Listener>
+uint8_t BasicXmlParser<Listener>::LookupNamespace(const char *uri, size_t length) {
+    for (int i=0;i<nsTableSize;i++) {
+        size_t entryLength = strlen(nsTable[i]);
+        bool prefix = entryLength && nsTable[i][entryLength-1] == '*';
+        if (prefix) entryLength--;
+        if ((prefix ? entryLength <= length : entryLength == length) && strncmp(uri, nsTable[i], entryLength) == 0) return i + 1;
+    }
+    return XML_NS_UNKNOWN;
+}
+
+/* Find the namespace currently bound to a prefix (innermost declaration wins) */
+template<class Listener>
+uint8_t BasicXmlParser<Listener>::ResolvePrefix(const char *prefix) {
+    for (int i=nsBindingCount-1;i>=0;i--) {
+        if (strcmp(nsBindings[i].prefix, prefix) == 0) return nsBindings[i].ns;
+    }
+    return XML_NS_UNKNOWN;
+}
+
+/* Split the attribute in the buffer into its name and value, removing the quotes from the value and
+ *  decoding any character references in it, and pass them on */
+template<class Listener>
+void BasicXmlParser<Listener>::Attribute() {
+    char *value = strchr(buffer, '=');
+
+    if (value) {
+        *value++ = '\0';
+        if (*value == '\"' || *value == '\'') {
+            char *close = strchr(value + 1, *value);
+            if (close) *close = '\0';
+            value++;
+        }
+        DecodeAttributeValue(value);
+    } else {
+        value = buffer + length;    // No value, so an empty string
+    }
+
+    NamespaceAttribute(buffer, value);
+    myListener->attribute(buffer, value, tags);
+}
+
+/* Decode the character references in an attribute value in place (decoding never lengthens it) */
+template<class Listener>
+void BasicXmlParser<Listener>::DecodeAttributeValue(char *value) {
+    char *output = value;
+    char *p = value;
+
+    while (*p) {
+        if (*p == '&') {
+            char *semicolon = strchr(p, ';');
+            if (semicolon && semicolon - p - 1 < XML_ENTITY_MAX_LENGTH) {
+                char name[XML_ENTITY_MAX_LENGTH];
+                char decoded[3];
+                memcpy(name, p + 1, semicolon - p - 1);
+                name[semicolon - p - 1] = '\0';
+                int count = DecodeReference(name, decoded);
+                if (count >= 0) {
+                    memcpy(output, decoded, count);
+                    output += count;
+                    p = semicolon + 1;
+                    continue;
+                }
+            }
+        }
+        *output++ = *p++;
+    }
+    *output = '\0';
+}
+
+/* If the attribute is an xmlns declaration, bind the prefix for the current element. The element is
+ *  already on the tag stack, so its own namespace is resolved again in case the declaration applies
+ *  to it. Its start tag isn't reported until all its attributes have been seen. */
+template<class Listener>
+void BasicXmlParser<Listener>::NamespaceAttribute(const char *name, const char *value) {
+    if (strncmp(name, "xmlns", 5) != 0 || (name[5] != ':' && name[5] != '\0')) return;
+
+    const char *prefix = name[5] ? name + 6 : name + 5;
+    size_t prefixLength = strlen(prefix);
+    if (prefixLength >= XML_PREFIX_MAX_LENGTH || nsBindingCount >= XML_MAX_NS_BINDINGS) return;
+
+    nsBinding *binding = &nsBindings[nsBindingCount++];
+    memcpy(binding->prefix, prefix, prefixLength + 1);
+    binding->ns = LookupNamespace(value, strlen(value));
+    binding->depth = tags.depth;
+
+    if (tagPrefixValid && tags.depth > 0 && tags.depth <= XML_MAX_DEPTH && strcmp(binding->prefix, tagPrefix) == 0) {
+        tags.ns[tags.depth-1] = binding->ns;
+    }
+}
+
+/* Push the tag in the buffer onto the tag stack. The listener isn't told until the end of the start
+ *  tag, so that any xmlns declarations among its attributes apply to the element itself. */
+template<class Listener>
+void BasicXmlParser<Listener>::StartTag() {
+    const char *localName = strchr(buffer, ':');
+    size_t prefixLength = localName ? localName - buffer : 0;
+
+    tagPrefixValid = prefixLength < XML_PREFIX_MAX_LENGTH;
+    if (tagPrefixValid) {
+        memcpy(tagPrefix, buffer, prefixLength);
+        tagPrefix[prefixLength] = '\0';
+    }
+    localName = localName ? localName + 1 : buffer;
+
+    if (rootClosed && tags.depth == 0) SyntaxError();   // A second document element
+
+    tags.depth++;
+    if (tags.depth <= XML_MAX_DEPTH) {
+        nameHash[tags.depth-1] = NameHash(buffer);
+        tags.id[tags.depth-1] = LookupTag(localName);
+        tags.ns[tags.depth-1] = tagPrefixValid ? ResolvePrefix(tagPrefix) : XML_NS_UNKNOWN;
+    }
+    strlcpy(tagName, buffer, sizeof(tagName));
+}
+
+/* Notify the listener of the element just started, now its attributes have been processed, returning
+ *  its XML_CONTINUE, XML_SKIP or XML_STOP response */
+template<class Listener>
+int BasicXmlParser<Listener>::ReportStartTag() {
+    int response = myListener->startTag(tagName, tags);
+    if (response == XML_STOP) stopped = true;
+    return response;
+}
+
+/* Start skipping the contents of the element just reported */
+template<class Listener>
+void BasicXmlParser<Listener>::BeginSkip() {
+    skipDepth = 1;
+    skipState = SKIP_TEXT;
+    skipQuote = 0;
+    skipLast = 0;
+    skipClosing = false;
+    skipMarkup = false;
+    ChangeState(STATE_SKIP);
+}
+
+/* Notify the listener while the closing tag is still on the stack, then pop it along with any
+ *  namespace declarations it made */
+template<class Listener>
+void BasicXmlParser<Listener>::EndTag() {
+    if (tags.depth == 0) {
+        /* End tag with nothing open */
+        SyntaxError();
+        return;
+    }
+    /* An empty tag with attributes only has the dummy " " name, so can't be checked */
+    if (buffer[0] != ' ' && tags.depth <= XML_MAX_DEPTH && nameHash[tags.depth-1] != NameHash(buffer)) SyntaxError();
+
+    if (myListener->endTag(buffer, tags) == XML_STOP) stopped = true;
+    while (nsBindingCount > 0 && nsBindings[nsBindingCount-1].depth >= tags.depth) nsBindingCount--;
+    tags.depth--;
+    if (tags.depth == 0) rootClosed = true;
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::ContextBufferAddChar(const char character) {
+    if (length < sizeof(buffer)-2) {
+        buffer[length] = character;
+        length++;
+        buffer[length] = '\0';
+    }
+}
+
+/* Add a character of element text to the buffer. Text isn't limited by the buffer size - when it's
+ *  full the contents are passed to the listener as a chunk and the buffer starts again. */
+template<class Listener>
+void BasicXmlParser<Listener>::ValueAddChar(const char character) {
+    if (length >= sizeof(buffer)-1) {
+        myListener->valueChunk(buffer, length, false, tags);
+        length = 0;
+    }
+    buffer[length] = character;
+    length++;
+    buffer[length] = '\0';
+    valueStarted = true;
+}
+
+/* Convert a decoded code point to at most 3 characters of output, returning how many. Listeners work
+ *  in plain ASCII, so typographic punctuation is replaced with its nearest equivalent and any other
+ *  non-ASCII character is dropped. */
+template<class Listener>
+int BasicXmlParser<Listener>::DecodeCodePoint(uint32_t codePoint, char *out) {
+    if (codePoint >= 0x20 && codePoint < 0x7F) {
+        out[0] = (char)codePoint;
+        return 1;
+    }
+    switch (codePoint) {
+        case '\t': case '\r': case '\n':
+        case 0xA0:                      // no-break space
+            out[0] = ' ';
+            return 1;
+        case 0x2010: case 0x2011: case 0x2012: case 0x2013: case 0x2014: case 0x2212:  // hyphens, dashes and minus
+            out[0] = '-';
+            return 1;
+        case 0x2018: case 0x2019: case 0x201A: case 0x2032:  // single quotes and prime
+            out[0] = '\'';
+            return 1;
+        case 0x201C: case 0x201D: case 0x201E: case 0x2033:  // double quotes and double prime
+            out[0] = '\"';
+            return 1;
+        case 0x2026:                    // ellipsis
+            out[0] = out[1] = out[2] = '.';
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+/* Decode a predefined entity or decimal/hex character reference (given without its '&' and ';') into
+ *  at most 3 characters of output. Returns how many, or -1 if the reference isn't recognised. */
+template<class Listener>
+int BasicXmlParser<Listener>::DecodeReference(const char *name, char *out) {
+    if (name[0] == '#') {
+        bool hex = (name[1] == 'x' || name[1] == 'X');
+        const char *digits = name + (hex ? 2 : 1);
+        char *digitsEnd;
+        uint32_t codePoint = strtoul(digits, &digitsEnd, hex ? 16 : 10);
+        if (digitsEnd != digits && *digitsEnd == '\0') return DecodeCodePoint(codePoint, out);
+        return -1;
+    }
+    if (strcmp(name, "amp") == 0) out[0] = '&';
+    else if (strcmp(name, "lt") == 0) out[0] = '<';
+    else if (strcmp(name, "gt") == 0) out[0] = '>';
+    else if (strcmp(name, "quot") == 0) out[0] = '\"';
+    else if (strcmp(name, "apos") == 0) out[0] = '\'';
+    else return -1;
+    return 1;
+}
+
+/* Copy an unrecognised or unterminated reference into the buffer unchanged */
+template<class Listener>
+void BasicXmlParser<Listener>::FlushEntity() {
+    inEntity = false;
+    ValueAddChar('&');
+    for (int i=0;i<entityLength;i++) ValueAddChar(entity[i]);
+}
+
+/* Decode the character reference that's just been completed into the buffer */
+template<class Listener>
+void BasicXmlParser<Listener>::DecodeEntity() {
+    char decoded[3];
+
+    entity[entityLength] = '\0';
+    int count = DecodeReference(entity, decoded);
+    if (count < 0) {
+        FlushEntity();
+        ValueAddChar(';');
+        return;
+    }
+    inEntity = false;
+    for (int i=0;i<count;i++) ValueAddChar(decoded[i]);
+}
+
+template<class Listener>
+void BasicXmlParser<Listener>::ChangeState(int newState) {
+    state = newState;
+    bInitialize=true;
+}
+
+/* Hash of a tag name for matching start and end tags. A mismatch that happens to collide goes unnoticed,
+ *  but a truncated or corrupted body almost always shows up elsewhere as well. */
+template<class Listener>
+uint8_t BasicXmlParser<Listener>::NameHash(const char *name) {
+    uint8_t hash = 0;
+    while (*name) hash = (uint8_t)((hash * 31) + *name++);
+    return hash;
+}
+
+/* Record the position of the first well-formedness error. Parsing carries on as best it can. */
+template<class Listener>
+void BasicXmlParser<Listener>::SyntaxError() {
+    if (errorPosition < 0) errorPosition = position;
+}
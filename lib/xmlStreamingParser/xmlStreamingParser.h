@@ -29,44 +29,13 @@
 
 #include <Arduino.h>
 #include <xmlListener.h>
+#include <BasicXmlParser.h>
 
-#define XML_BUFFER_MAX_LENGTH 350
-
-#define STATE_NULL 0
-#define STATE_BEGIN 1
-#define STATE_STARTTAG 2
-#define STATE_TAGNAME 3
-#define STATE_TAGCONTENTS 4
-#define STATE_ENDTAG 5
-#define STATE_EMPTYTAG 6
-#define STATE_ATTRIBUTE 7
-
-class xmlStreamingParser {
-  private:
-
-    int state;
-    int nextState;
-    xmlListener* myListener;
-
-    char buffer[XML_BUFFER_MAX_LENGTH];
-    bool bInitialize;   // True for the first call into a state
-    bool inAttrQuote = false; // true if we're inside a quoted attribute string
-    uint32_t length;
-
-    void state_Begin(const char character);
-    void state_StartTag(const char character);
-    void state_TagName(const char character);
-    void state_EmptyTag(const char character);
-    void state_TagContents(const char character);
-    void state_Attribute(const char character);
-    void state_EndTag(const char character);
-    void ContextBufferAddChar(const char character);
-    void ChangeState(int newState);
-
-  public:
-    xmlStreamingParser();
-    void parse(const char character);
-    void setListener(xmlListener* listener);
-    void reset();
+//
+// Parser for listeners derived from xmlListener, with the handlers called through its virtual interface.
+// The implementation is instantiated once, in xmlStreamingParser.cpp.
+//
+extern template class BasicXmlParser<xmlListener>;
 
+class xmlStreamingParser : public BasicXmlParser<xmlListener> {
 };
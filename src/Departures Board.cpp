@@ -37,8 +37,12 @@
 #include <WiFiManager.h>
 #include <weatherClient.h>
 #include <stationData.h>
+#include <boardBuffer.h>
 #include <raildataXmlClient.h>
 #include <TfLdataClient.h>
+#include <responseCapture.h>
+#include <pollScheduler.h>
+#include <requestBudget.h>
 #include <githubClient.h>
 #include <webgui/webgraphics.h>
 #include <webgui/index.h>
@@ -279,6 +283,7 @@ bool sleepEnabled = false;          // Is overnight sleep enabled?
 bool dateEnabled = false;           // Showing the date on screen?
 bool weatherEnabled = false;        // Showing weather at station location. Requires an OpenWeatherMap API key.
 bool enableBus = false;             // Include Bus services on the board?
+bool arrDepMode = false;            // Include services arriving here on the National Rail board?
 bool firmwareUpdates = true;        // Check for and install firmware updates automatically at boot?
 byte sleepStarts = 0;               // Hour at which the overnight sleep (screensaver) begins
 byte sleepEnds = 6;                 // Hour at which the overnight sleep (screensaver) ends
@@ -327,7 +332,8 @@ bool isScrollingStops = false;
 int currentMessage = 0;
 int prevMessage = 0;
 int prevScrollStopsLength = 0;
-char line2[4+MAXBOARDMESSAGES][MAXMESSAGESIZE+12];
+const char *line2[4+MAXBOARDMESSAGES];              // The lines scrolled along the bottom of the board
+char line2Text[4][MAXMESSAGESIZE+12];               // Lines made up from the first service, the rest point at the board's messages
 
 // Line 3 (additional services)
 int line3Service = 0;
@@ -349,7 +355,12 @@ unsigned long refreshTimer = 0;
 
 #define SCREENSAVERINTERVAL 10000   // How often the screen is changed in sleep mode (ms - 10 seconds)
 #define DATAUPDATEINTERVAL 150000   // How often we fetch data from National Rail (ms - 2.5 mins)
+#define DATAUPDATEMIN 60            // Default bounds on the adaptive National Rail interval (secs, "pollMin"/"pollMax" in config.json)
+#define DATAUPDATEMAX 300
 #define UGDATAUPDATEINTERVAL 30000  // How often we fetch data from TfL (ms - 30 secs)
+#define UGDATAUPDATEMIN 20          // Default bounds on the adaptive TfL interval (secs, "tubePollMin"/"tubePollMax" in config.json)
+#define UGDATAUPDATEMAX 90
+#define INCOMPLETERETRYINTERVAL 10000   // How soon we first try again after a truncated/corrupt response (ms - 10 secs)
 
 // Weather Stuff
 char weatherMsg[46];                            // Current weather at station location
@@ -358,9 +369,20 @@ String openWeatherMapApiKey = "";               // The API key to use
 weatherClient currentWeather;                   // Create a weather client
 
 bool noDataLoaded = true;                       // True if no data received for the station
+
+// The update intervals adapt to how soon the next service goes and how often the board is changing
+pollScheduler nrPolls(DATAUPDATEINTERVAL,DATAUPDATEMIN*1000UL,DATAUPDATEMAX*1000UL);
+pollScheduler tubePolls(UGDATAUPDATEINTERVAL,UGDATAUPDATEMIN*1000UL,UGDATAUPDATEMAX*1000UL,false);
 int lastUpdateResult = 0;                       // Result of last data refresh
+int incompleteResponses = 0;                    // Consecutive truncated/corrupt responses
 unsigned long lastDataLoadTime = 0;             // Timestamp of last data load
 
+// Boot phase timings (ms since power on) for the /info page
+unsigned long bootWiFiTime = 0;                 // Wi-Fi connected
+unsigned long bootClockTime = 0;                // System clock set
+unsigned long bootInitTime = 0;                 // Data interface initialised (includes the WSDL download if not cached)
+unsigned long bootFirstBoardTime = 0;           // First board loaded
+
 #define MAXHOSTSIZE 48                          // Maximum size of the wsdl Host
 #define MAXAPIURLSIZE 48                        // Maximum size of the wsdl url
 
@@ -371,10 +393,12 @@ char wsdlAPI[MAXAPIURLSIZE];                    // wsdl API url
 raildataXmlClient* raildata = nullptr;
 // TfL Client
 TfLdataClient* tfldata = nullptr;
-// Station Data (shared)
-rdStation station;
-// Station Messages (shared)
-stnMessages messages;
+// Last few responses kept for debugging (enabled by "capture":true in config.json)
+responseCapture capture;
+// Station Data and Messages (shared). Updates are filled in the back board and then published.
+boardBuffer board;
+const rdStation *station = &board.current()->station;       // The published board
+const stnMessages *messages = &board.current()->messages;
 
 /*
  * Graphics helper functions for OLED panel
@@ -798,6 +822,20 @@ void loadConfig() {
         if (settings["wsdlAPI"].is<const char*>())    strlcpy(wsdlAPI, settings["wsdlAPI"], sizeof(wsdlAPI));
         if (settings["showDate"].is<bool>())          dateEnabled = settings["showDate"];
         if (settings["showBus"].is<bool>())           enableBus = settings["showBus"];
+        if (settings["arrDep"].is<bool>())            arrDepMode = settings["arrDep"];
+        if (settings["capture"].is<bool>())           capture.setEnabled(settings["capture"]);
+        nrPolls.setLimits((settings["pollMin"] | DATAUPDATEMIN) * 1000UL, (settings["pollMax"] | DATAUPDATEMAX) * 1000UL);
+        tubePolls.setLimits((settings["tubePollMin"] | UGDATAUPDATEMIN) * 1000UL, (settings["tubePollMax"] | UGDATAUPDATEMAX) * 1000UL);
+        nrPolls.reset();
+        tubePolls.reset();
+        if (settings["budget"].is<JsonObject>()) {
+          // Optional hourly request budgets for each upstream API, 0 for no limit
+          JsonObject budget = settings["budget"];
+          if (budget["darwin"].is<int>())   apiBudget.setLimit(UPSTREAM_DARWIN,budget["darwin"],DARWINBURST);
+          if (budget["tfl"].is<int>())      apiBudget.setLimit(UPSTREAM_TFL,budget["tfl"],TFLBURST);
+          if (budget["weather"].is<int>())  apiBudget.setLimit(UPSTREAM_WEATHER,budget["weather"],WEATHERBURST);
+          if (budget["github"].is<int>())   apiBudget.setLimit(UPSTREAM_GITHUB,budget["github"],GITHUBBURST);
+        }
         if (settings["sleep"].is<bool>())             sleepEnabled = settings["sleep"];
         if (settings["weather"].is<bool>() && openWeatherMapApiKey.length())
                                                     weatherEnabled = settings["weather"];
@@ -824,7 +862,7 @@ void loadConfig() {
     }
   } else {
     // Write a default config file so that the Web GUI works initially
-    String defaultConfig = "{\"crs\":\"\",\"station\":\"\",\"lat\":0,\"lon\":0,\"weather\":" + String((openWeatherMapApiKey.length())?"true":"false") + F(",\"sleep\":false,\"showDate\":false,\"showBus\":false,\"update\":true,\"sleepStarts\":23,\"sleepEnds\":8,\"brightness\":20,\"tube\":false}");
+    String defaultConfig = "{\"crs\":\"\",\"station\":\"\",\"lat\":0,\"lon\":0,\"weather\":" + String((openWeatherMapApiKey.length())?"true":"false") + F(",\"sleep\":false,\"showDate\":false,\"showBus\":false,\"arrDep\":false,\"update\":true,\"sleepStarts\":23,\"sleepEnds\":8,\"brightness\":20,\"tube\":false}");
     saveFile("/config.json",defaultConfig);
     strcpy(crsCode,"");
   }
@@ -927,16 +965,48 @@ bool checkForFirmwareUpdate() {
  * Station Board functions - pulling updates and animating the Departures Board main display
  */
 
+// How long to wait before retrying after a truncated/corrupt response. The first retry is soon, but the wait
+// doubles with each one in a row (up to the normal interval) so a persistently bad connection isn't hammered.
+unsigned long incompleteRetryInterval(unsigned long updateInterval) {
+  unsigned long interval = INCOMPLETERETRYINTERVAL;
+  for (int i=1;i<incompleteResponses && interval<updateInterval;i++) interval*=2;
+  return (interval<updateInterval) ? interval : updateInterval;
+}
+
+// Show the board from the last update. The one shown until now becomes the back board for the next update.
+void publishBoard() {
+  board.publish();
+  station = &board.current()->station;
+  messages = &board.current()->messages;
+}
+
+// Minutes until the first service on the board goes (-1 if there isn't one). Also brings timeinfo up to date.
+int minutesToFirstService() {
+  getLocalTime(&timeinfo);    // The hour is used for the next poll even when the board's empty
+  if (!station->numServices) return -1;
+  const rdService *first = &station->service[0];
+  const char *due = first->sTime[0] ? first->sTime : first->sta;
+  const char *expected = first->sTime[0] ? first->etd : first->eta;
+  if (isDigit(expected[0])) due = expected;   // Running late
+  return pollScheduler::minutesUntil(due, timeinfo.tm_hour, timeinfo.tm_min);
+}
+
 // Request a data update via the raildataClient
 bool getStationBoard() {
   if (!firstLoad) showUpdateIcon(true);
-  lastUpdateResult = raildata->updateDepartures(&station,&messages,crsCode,nrToken,MAXBOARDSERVICES,enableBus,callingCrsCode);
+  stnBoard *next = board.back();
+  lastUpdateResult = raildata->updateDepartures(&next->station,&next->messages,crsCode,nrToken,MAXBOARDSERVICES,enableBus,callingCrsCode,arrDepMode);
+  if (lastUpdateResult == UPD_SUCCESS) publishBoard();     // Nothing is copied back when there are no changes
   nextDataUpdate = millis()+DATAUPDATEINTERVAL; // default update freq
+  if (lastUpdateResult == UPD_INCOMPLETE) incompleteResponses++; else incompleteResponses=0;
   if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) {
+    int minutesToFirst = minutesToFirstService();
+    nextDataUpdate = millis() + nrPolls.nextInterval(lastUpdateResult == UPD_SUCCESS, minutesToFirst, messages->numMessages > 0, timeinfo.tm_hour);
     showUpdateIcon(false);
     lastDataLoadTime=millis();
     noDataLoaded=false;
     dataLoadSuccess++;
+    if (!bootFirstBoardTime) bootFirstBoardTime=millis();
     return true;
   } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT) {
     lastLoadFailure=millis();
@@ -944,6 +1014,18 @@ bool getStationBoard() {
     nextDataUpdate = millis() + 30000; // 30 secs
     showUpdateIcon(false);
     return false;
+  } else if (lastUpdateResult == UPD_INCOMPLETE) {
+    // Response was cut short - the board still has the previous data, so just try again soon
+    lastLoadFailure=millis();
+    dataLoadFailure++;
+    nextDataUpdate = millis() + incompleteRetryInterval(DATAUPDATEINTERVAL);
+    showUpdateIcon(false);
+    return false;
+  } else if (lastUpdateResult == UPD_THROTTLED) {
+    // Nothing was requested, so keep showing the current board until the budget allows another request
+    nextDataUpdate = millis() + apiBudget.getWait(UPSTREAM_DARWIN) + 1000;
+    showUpdateIcon(false);
+    return false;
   } else if (lastUpdateResult == UPD_UNAUTHORISED) {
     showTokenErrorScreen();
     while (true) { server.handleClient(); yield();}
@@ -954,28 +1036,48 @@ bool getStationBoard() {
   }
 }
 
+// A service that terminates here (arrivals board only) is shown by its arrival rather than its departure
+bool arrivalOnly(int line) {
+  return !station->service[line].sTime[0];
+}
+
+const char *serviceTime(int line) {
+  return arrivalOnly(line) ? station->service[line].sta : station->service[line].sTime;
+}
+
+void serviceStatus(int line, char *status) {
+  const char *expected = arrivalOnly(line) ? station->service[line].eta : station->service[line].etd;
+  if (isDigit(expected[0])) sprintf(status,"Exp %s",expected);
+  else strcpy(status,expected);
+}
+
+// The destination, or where the service is coming from if it terminates here
+void serviceDestination(int line, char *destination) {
+  if (arrivalOnly(line)) sprintf(destination,"from %s",station->service[line].destination);
+  else strcpy(destination,station->service[line].destination);
+}
+
 // Draw the primary service line
 void drawPrimaryService(bool showVia) {
   int destPos;
-  char clipDestination[MAXLOCATIONSIZE];
+  char clipDestination[MAXLOCATIONSIZE+5];
   char etd[16];
 
   u8g2.setFont(NatRailTall12);
   blankArea(0,LINE1,256,LINE2-LINE1);
-  destPos = u8g2.drawStr(0,LINE1-1,station.service[0].sTime) + 6;
-  if (station.service[0].platform[0] && strlen(station.service[0].platform)<3 && station.service[0].serviceType == TRAIN) {
-    destPos += u8g2.drawStr(destPos,LINE1-1,station.service[0].platform) + 6;
-  } else if (station.service[0].serviceType == BUS) {
+  destPos = u8g2.drawStr(0,LINE1-1,serviceTime(0)) + 6;
+  if (station->service[0].platform[0] && strlen(station->service[0].platform)<3 && station->service[0].serviceType == TRAIN) {
+    destPos += u8g2.drawStr(destPos,LINE1-1,station->service[0].platform) + 6;
+  } else if (station->service[0].serviceType == BUS) {
     destPos += u8g2.drawStr(destPos,LINE1-1,"~") + 6; // Bus icon
   }
-  if (isDigit(station.service[0].etd[0])) sprintf(etd,"Exp %s",station.service[0].etd);
-  else strcpy(etd,station.service[0].etd);
+  serviceStatus(0,etd);
   int etdWidth = getStringWidth(etd);
   u8g2.drawStr(SCREEN_WIDTH - etdWidth,LINE1-1,etd);
   // Space available for destination name
   int spaceAvailable = SCREEN_WIDTH - destPos - etdWidth - 6;
-  if (showVia) strcpy(clipDestination,station.service[0].via);
-  else strcpy(clipDestination,station.service[0].destination);
+  if (showVia) strcpy(clipDestination,station->service[0].via);
+  else serviceDestination(0,clipDestination);
   if (getStringWidth(clipDestination) > spaceAvailable) {
     while (getStringWidth(clipDestination) > (spaceAvailable - 8)) {
       clipDestination[strlen(clipDestination)-1] = '\0';
@@ -991,7 +1093,7 @@ void drawPrimaryService(bool showVia) {
 
 // Draw the secondary service line
 void drawServiceLine(int line, int y) {
-  char clipDestination[30];
+  char clipDestination[MAXLOCATIONSIZE+5];
   char ordinal[5];
 
   switch (line) {
@@ -1009,28 +1111,27 @@ void drawServiceLine(int line, int y) {
   u8g2.setFont(NatRailSmall9);
   blankArea(0,y,256,9);
 
-  if (line<station.numServices) {
+  if (line<station->numServices) {
     u8g2.drawStr(0,y-1,ordinal);
-    int destPos = u8g2.drawStr(23,y-1,station.service[line].sTime) + 27;
+    int destPos = u8g2.drawStr(23,y-1,serviceTime(line)) + 27;
     char plat[3];
-    if (station.platformAvailable) {
-      if (station.service[line].platform[0] && strlen(station.service[line].platform)<3 && station.service[line].serviceType == TRAIN) {
-        strncpy(plat,station.service[line].platform,3);
+    if (station->platformAvailable) {
+      if (station->service[line].platform[0] && strlen(station->service[line].platform)<3 && station->service[line].serviceType == TRAIN) {
+        strncpy(plat,station->service[line].platform,3);
         plat[2]='\0';
       } else {
-        if (station.service[line].serviceType == BUS) strcpy(plat,"~");  // Bus icon
+        if (station->service[line].serviceType == BUS) strcpy(plat,"~");  // Bus icon
         else strcpy(plat,"}}");
       }
       u8g2.drawStr(destPos+11-getStringWidth(plat),y-1,plat);
       destPos+=16;
     }
     char etd[16];
-    if (isDigit(station.service[line].etd[0])) sprintf(etd,"Exp %s",station.service[line].etd);
-    else strcpy(etd,station.service[line].etd);
+    serviceStatus(line,etd);
     int etdWidth = getStringWidth(etd);
     u8g2.drawStr(SCREEN_WIDTH - etdWidth,y-1,etd);
     // work out if we need to clip the destination
-    strcpy(clipDestination,station.service[line].destination);
+    serviceDestination(line,clipDestination);
 
     int spaceAvailable = SCREEN_WIDTH - destPos - etdWidth - 6;
 
@@ -1044,7 +1145,7 @@ void drawServiceLine(int line, int y) {
     }
     u8g2.drawStr(destPos,y-1,clipDestination);
   } else {
-    if (weatherMsg[0] && line==station.numServices) {
+    if (weatherMsg[0] && line==station->numServices) {
       // We're showing the weather
       centreText(weatherMsg,y-1);
     } else {
@@ -1068,8 +1169,8 @@ void drawStationBoard() {
   }
   u8g2.setFont(NatRailSmall9);
   char boardTitle[95];
-  if (callingStation[0]) snprintf(boardTitle,sizeof(boardTitle),"%s  (%c%s)",station.location,129,callingStation);
-  else strncpy(boardTitle,station.location,sizeof(boardTitle));
+  if (callingStation[0]) snprintf(boardTitle,sizeof(boardTitle),"%s  (%c%s)",station->location,129,callingStation);
+  else strncpy(boardTitle,station->location,sizeof(boardTitle));
 
   if (dateEnabled) {
     // Get the date
@@ -1097,84 +1198,85 @@ void drawStationBoard() {
   // Draw the primary service line
   isShowingVia=false;
   viaTimer=millis()+300000;  // effectively don't check for via
-  if (station.numServices) {
+  if (station->numServices) {
     drawPrimaryService(false);
-    if (station.service[0].via[0]) viaTimer=millis()+4000;
-    if (station.service[0].isCancelled) {
+    if (station->service[0].via[0]) viaTimer=millis()+4000;
+    if (station->service[0].isCancelled) {
       // This train is cancelled
-      if (station.serviceMessage[0]) {
-        strcpy(line2[0],station.serviceMessage);
+      if (station->serviceMessage[0]) {
+        strcpy(line2Text[0],station->serviceMessage);
         numMessages=1;
       }
     } else {
       // The train is not cancelled
-      if (station.service[0].isDelayed && station.serviceMessage[0]) {
+      if (station->service[0].isDelayed && station->serviceMessage[0]) {
         // The train is delayed and there's a reason
-        strcpy(line2[0],station.serviceMessage);
+        strcpy(line2Text[0],station->serviceMessage);
         numMessages++;
       }
-      if (station.calling[0]) {
+      if (station->calling[0]) {
         // Add the calling stops message
-        sprintf(line2[numMessages],"Calling at: %s",station.calling);
+        sprintf(line2Text[numMessages],"Calling at: %s",station->calling);
         numMessages++;
       }
-      if (strcmp(station.origin, station.location)==0) {
+      if (strcmp(station->origin, station->location)==0) {
         // Service originates at this station
-        if (station.service[0].opco[0]) {
-          sprintf(line2[numMessages],"This %s service starts here.",station.service[0].opco);
+        if (station->service[0].opco[0]) {
+          sprintf(line2Text[numMessages],"This %s service starts here.",station->service[0].opco);
         } else {
-          strcpy(line2[numMessages],"This service starts here.");
+          strcpy(line2Text[numMessages],"This service starts here.");
         }
         // Add the seating if available
-        switch (station.service[0].classesAvailable) {
+        switch (station->service[0].classesAvailable) {
           case 1:
-            strcat(line2[numMessages],firstClassSeating);
+            strcat(line2Text[numMessages],firstClassSeating);
             break;
           case 2:
-            strcat(line2[numMessages],standardClassSeating);
+            strcat(line2Text[numMessages],standardClassSeating);
             break;
           case 3:
-            strcat(line2[numMessages],dualClassSeating);
+            strcat(line2Text[numMessages],dualClassSeating);
             break;
         }
         numMessages++;
       } else {
         // Service originates elsewhere
-        strcpy(line2[numMessages],"");
-        if (station.service[0].opco[0]) {
-          if (station.origin[0]) {
-            sprintf(line2[numMessages],"This is the %s service from %s.",station.service[0].opco,station.origin);
+        strcpy(line2Text[numMessages],"");
+        if (station->service[0].opco[0]) {
+          if (station->origin[0]) {
+            sprintf(line2Text[numMessages],"This is the %s service from %s.",station->service[0].opco,station->origin);
           } else {
-            sprintf(line2[numMessages],"This is the %s service.",station.service[0].opco);
+            sprintf(line2Text[numMessages],"This is the %s service.",station->service[0].opco);
           }
         } else {
-          if (station.origin[0]) {
-            sprintf(line2[numMessages],"This service originated at %s.",station.origin);
+          if (station->origin[0]) {
+            sprintf(line2Text[numMessages],"This service originated at %s.",station->origin);
           }
         }
         // Add the seating if available
-        switch (station.service[0].classesAvailable) {
+        switch (station->service[0].classesAvailable) {
           case 1:
-            strcat(line2[numMessages],firstClassSeating);
+            strcat(line2Text[numMessages],firstClassSeating);
             break;
           case 2:
-            strcat(line2[numMessages],standardClassSeating);
+            strcat(line2Text[numMessages],standardClassSeating);
             break;
           case 3:
-            strcat(line2[numMessages],dualClassSeating);
+            strcat(line2Text[numMessages],dualClassSeating);
             break;
         }
-        if (line2[numMessages][0]) numMessages++;
+        if (line2Text[numMessages][0]) numMessages++;
       }
-      if (station.service[0].trainLength) {
+      if (station->service[0].trainLength) {
         // Add the number of carriages message
-        sprintf(line2[numMessages],"This train is formed of %d coaches.",station.service[0].trainLength);
+        sprintf(line2Text[numMessages],"This train is formed of %d coaches.",station->service[0].trainLength);
         numMessages++;
       }
     }
+    for (int i=0;i<numMessages;i++) line2[i]=line2Text[i];
     // Add any nrcc messages
-    for (int i=0;i<messages.numMessages;i++) {
-      strcpy(line2[numMessages],messages.messages[i]);
+    for (int i=0;i<messages->numMessages;i++) {
+      line2[numMessages]=messages->messages[i];
       numMessages++;
     }
     // Setup for the first message to rollover to
@@ -1184,10 +1286,8 @@ void drawStationBoard() {
     blankArea(0,LINE2,256,LINE4-LINE2);
     u8g2.setFont(NatRailTall12);
     centreText(F("There are no scheduled services at this station."),LINE1-1);
-    numMessages = messages.numMessages;
-    for (int i=0;i<messages.numMessages;i++) {
-      strcpy(line2[i],messages.messages[i]);
-    }
+    numMessages = messages->numMessages;
+    for (int i=0;i<messages->numMessages;i++) line2[i]=messages->messages[i];
     // Setup for the first message to rollover to
     isScrollingStops=false;
     currentMessage=numMessages-1;
@@ -1196,6 +1296,25 @@ void drawStationBoard() {
   u8g2.sendBuffer();
 }
 
+// Redraw only the parts of the board that changed in the last update. The message line is built from the first
+// service and the messages, so the board is only redrawn (restarting the messages) if one of those changed.
+void refreshStationBoard() {
+  if (station->detailsChanged || station->messageChanges || !station->numServices) {
+    drawStationBoard();
+    return;
+  }
+  // The messages haven't changed, but the lines showing them still point into the board published before
+  for (int i=0;i<messages->numMessages;i++) line2[numMessages-messages->numMessages+i]=messages->messages[i];
+  if (station->rowChanges & 1) {
+    if (!station->service[0].via[0]) isShowingVia=false;
+    else if (!isShowingVia && viaTimer>millis()+4000) viaTimer=millis()+4000; // The via has only just appeared
+    drawPrimaryService(isShowingVia);
+    u8g2.updateDisplayArea(0,1,32,3);
+  }
+  // The service line at the bottom is sent with the next frame
+  if (line3Service>0 && line3Service<MAXBOARDSERVICES && (station->rowChanges & (1<<line3Service))) drawServiceLine(line3Service,LINE3);
+}
+
 /*
  *
  * London Underground Board
@@ -1244,13 +1363,20 @@ void tflCallback() {
 
 bool getUndergroundBoard() {
   if (!firstLoad) showUpdateIcon(true);
-  lastUpdateResult = tfldata->updateArrivals(&station,&messages,tubeId,tflAppkey,&tflCallback);
+  stnBoard *next = board.back();
+  lastUpdateResult = tfldata->updateArrivals(&next->station,&next->messages,tubeId,tflAppkey,&tflCallback);
+  if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) publishBoard();  // Arrival times are always updated
   nextDataUpdate = millis()+UGDATAUPDATEINTERVAL; // default update freq
+  if (lastUpdateResult == UPD_INCOMPLETE) incompleteResponses++; else incompleteResponses=0;
   if (lastUpdateResult == UPD_SUCCESS || lastUpdateResult == UPD_NO_CHANGE) {
+    int minutesToFirst = station->numServices ? station->service[0].timeToStation / 60 : -1;
+    getLocalTime(&timeinfo);
+    nextDataUpdate = millis() + tubePolls.nextInterval(lastUpdateResult == UPD_SUCCESS, minutesToFirst, messages->numMessages > 0, timeinfo.tm_hour);
     showUpdateIcon(false);
     lastDataLoadTime=millis();
     noDataLoaded=false;
     dataLoadSuccess++;
+    if (!bootFirstBoardTime) bootFirstBoardTime=millis();
     return true;
   } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT) {
     lastLoadFailure=millis();
@@ -1258,6 +1384,18 @@ bool getUndergroundBoard() {
     nextDataUpdate = millis() + 30000; // 30 secs
     showUpdateIcon(false);
     return false;
+  } else if (lastUpdateResult == UPD_INCOMPLETE) {
+    // Response was cut short - the board still has the previous data, so just try again soon
+    lastLoadFailure=millis();
+    dataLoadFailure++;
+    nextDataUpdate = millis() + incompleteRetryInterval(UGDATAUPDATEINTERVAL);
+    showUpdateIcon(false);
+    return false;
+  } else if (lastUpdateResult == UPD_THROTTLED) {
+    // Nothing was requested, so keep showing the current board until the budget allows another request
+    nextDataUpdate = millis() + apiBudget.getWait(UPSTREAM_TFL) + 1000;
+    showUpdateIcon(false);
+    return false;
   } else if (lastUpdateResult == UPD_UNAUTHORISED) {
     showTokenErrorScreen();
     while (true) { server.handleClient(); yield();}
@@ -1274,13 +1412,13 @@ void drawUndergroundService(int serviceId, int y) {
   u8g2.setFont(Underground10);
   blankArea(0,y,256,10);
 
-  if (serviceId < station.numServices) {
-    sprintf(serviceData,"%d %s",serviceId+1,station.service[serviceId].destination);
+  if (serviceId < station->numServices) {
+    sprintf(serviceData,"%d %s",serviceId+1,station->service[serviceId].destination);
     u8g2.drawStr(0,y-1,serviceData);
-    if (serviceId || station.service[serviceId].timeToStation > 30) {
-      if (station.service[serviceId].timeToStation <= 60) u8g2.drawStr(SCREEN_WIDTH-19,y-1,"Due");
+    if (serviceId || station->service[serviceId].timeToStation > 30) {
+      if (station->service[serviceId].timeToStation <= 60) u8g2.drawStr(SCREEN_WIDTH-19,y-1,"Due");
       else {
-        int mins = (station.service[serviceId].timeToStation + 30) / 60; // Round to nearest minute
+        int mins = (station->service[serviceId].timeToStation + 30) / 60; // Round to nearest minute
         sprintf(serviceData,"%d",mins);
         if (mins==1) u8g2.drawStr(SCREEN_WIDTH-22,y-1,"min"); else u8g2.drawStr(SCREEN_WIDTH-22,y-1,"mins");
         u8g2.drawStr(SCREEN_WIDTH-27-(strlen(serviceData)*7),y-1,serviceData);
@@ -1291,7 +1429,7 @@ void drawUndergroundService(int serviceId, int y) {
 
 // Draw/update the Underground Arrivals Board
 void drawUndergroundBoard() {
-  numMessages = messages.numMessages;
+  numMessages = messages->numMessages;
   if (line3Service==0) line3Service=1;
   if (firstLoad) {
     // Clear the entire screen for the first load since boot up/wake from sleep
@@ -1322,7 +1460,7 @@ void drawUndergroundBoard() {
     centreText(tubeName.c_str(),ULINE0-1);
   }
 
-  if (station.boardChanged) {
+  if (station->boardChanged) {
     // prepare to scroll up primary services
     scrollPrimaryYpos = 11;
     isScrollingPrimary = true;
@@ -1333,20 +1471,17 @@ void drawUndergroundBoard() {
     serviceTimer=0;
   } else {
     // Draw the primary service line(s)
-    if (station.numServices) {
+    if (station->numServices) {
       drawUndergroundService(0,ULINE1);
-      if (station.numServices>1) drawUndergroundService(1,ULINE2);
+      if (station->numServices>1) drawUndergroundService(1,ULINE2);
     } else {
       u8g2.setFont(Underground10);
       centreText(F("There are no scheduled arrivals at this station."),ULINE1-1);
     }
   }
-  for (int i=0;i<messages.numMessages;i++) {
-    strcpy(line2[i],messages.messages[i]);
-  }
+  for (int i=0;i<messages->numMessages;i++) line2[i]=messages->messages[i];
   // Add attribution msg
-  strcpy(line2[messages.numMessages],"Powered by TfL Open Data");
-  messages.numMessages++;
+  line2[numMessages++]="Powered by TfL Open Data";
 
   u8g2.sendBuffer();
 }
@@ -1368,6 +1503,9 @@ void sendResponse(int code, String msg) {
 String getContentType(String filename) {
   if (server.hasArg(F("download"))) {
     return F("application/octet-stream");
+  } else if (filename.startsWith(F(CAPTUREDIR "/"))) {
+    // Captured responses are downloaded as they are. A .gz capture isn't to be unzipped by the browser on the way.
+    return F("application/octet-stream");
   } else if (filename.endsWith(F(".htm"))) {
     return F("text/html");
   } else if (filename.endsWith(F(".html"))) {
@@ -1540,6 +1678,7 @@ void handleSaveSettings() {
           tfldata = nullptr;
           // Create the NR client
           raildata = new raildataXmlClient();
+          raildata->setCapture(&capture);
           int res = raildata->init(wsdlHost, wsdlAPI, &raildataCallback);
           if (res != UPD_SUCCESS) {
             showWsdlFailureScreen();
@@ -1551,6 +1690,7 @@ void handleSaveSettings() {
           raildata = nullptr;
           // Create the TfL client
           tfldata = new TfLdataClient();
+          tfldata->setCapture(&capture);
         }
       }
       if (tubeMode) progressBar(F("Initialising TfL interface"),70);
@@ -1614,6 +1754,24 @@ void handleCat() {
   } else sendResponse(404,F("Not found"));
 }
 
+// List the captured responses, newest first, with links to download them
+void handleCaptureList() {
+  captureInfo captures[CAPTURESLOTS];
+  int count = capture.getCaptures(captures);
+
+  String output=F("<html><body><p>Response capture is ");
+  output+=capture.isEnabled() ? F("on") : F("off (set \"capture\":true in config.json to turn it on)");
+  output+=F("</p><table>");
+  for (int i=0;i<count;i++) {
+    output+="<tr><td>" + String(captures[i].source) + F("</td><td>") + String(captures[i].bytes) + F(" bytes");
+    if (captures[i].compressed) output+=F(" gzip");
+    if (captures[i].truncated) output+=F(" (truncated)");
+    output+="</td><td><a href=\"/cat?f=" + String(captures[i].path) + F("\">") + String(captures[i].path) + F("</a></td></tr>");
+  }
+  output+=F("</table></body></html>");
+  server.send(200,contentTypeHtml,output);
+}
+
 // Delete a file from the file system
 void handleDelete() {
   String filename;
@@ -1704,16 +1862,28 @@ void handleInfo() {
   message+="\nSystem clock: " + String(sysUptime);
   message+="\nCRS station code: " + String(crsCode) + F("\nNaptan station code: ") + String(tubeId) + F("\nSuccessful: ") + String(dataLoadSuccess) + F("\nFailures: ") + String(dataLoadFailure) + F("\nTime since last data load: ") + String((int)((millis()-lastDataLoadTime)/1000)) + F(" seconds");
   if (dataLoadFailure) message+="\nTime since last failure: " + String((int)((millis()-lastLoadFailure)/1000)) + F(" seconds");
+  message+="\nNext data load: " + String((long)(nextDataUpdate-millis())/1000) + F(" seconds (") + String(tubeMode ? tubePolls.getUnchanged() : nrPolls.getUnchanged()) + F(" loads in a row without changes)");
   message+=F("\nLast Result: ");
   if (!tubeMode) {
     message+=raildata->getLastError();
   } else {
     message+=tfldata->lastErrorMsg;
   }
-  message+="\nServices: " + String(station.numServices) + F("\nMessages: ");
-  if (tubeMode) message+=String(messages.numMessages-1); else message+=String(messages.numMessages);
-  message+=F("\n");
-  for (int i=0;i<messages.numMessages;i++) message+=String(messages.messages[i]) + "\n";
+  if (!tubeMode) message+="\nDarwin connection: " + raildata->getConnectionStats();
+  else {
+    message+="\nTfL last update: " + String(tfldata->lastBytesReceived) + F(" bytes");
+    if (tfldata->lastCompressed) message+=" gzip (" + String(tfldata->lastBytesDecoded) + F(" bytes of JSON)");
+  }
+  if (weatherEnabled && currentWeather.lastBytesReceived) {
+    message+="\nWeather last update: " + String(currentWeather.lastBytesReceived) + F(" bytes");
+    if (currentWeather.lastCompressed) message+=" gzip (" + String(currentWeather.lastBytesDecoded) + F(" bytes of JSON)");
+  }
+  message+="\nBoot timing: Wi-Fi " + String(bootWiFiTime) + F("ms, clock ") + String(bootClockTime) + F("ms, data interface ") + String(bootInitTime) + F("ms (took ") + String(bootInitTime-bootClockTime) + F("ms), first board ");
+  if (bootFirstBoardTime) message+=String(bootFirstBoardTime) + F("ms"); else message+=F("not loaded");
+  message+="\nServices: " + String(station->numServices) + F("\nMessages: ");
+  message+=String(messages->numMessages) + F("\n");
+  for (int i=0;i<messages->numMessages;i++) message+=String(messages->messages[i]) + "\n";
+  message+="\nRequest budget: " + apiBudget.getStats() + F("\n");
   message+=F("\nUpdate result code: ");
   switch (lastUpdateResult) {
     case UPD_SUCCESS:
@@ -1732,7 +1902,7 @@ void handleInfo() {
       message+=F("HTTP ERROR");
       break;
     case UPD_INCOMPLETE:
-      message+=F("INCOMPLETE JSON RECEIVED");
+      message+=F("INCOMPLETE DATA RECEIVED");
       break;
     case UPD_NO_RESPONSE:
       message+=F("NO RESPONSE FROM SERVER");
@@ -1740,6 +1910,9 @@ void handleInfo() {
     case UPD_TIMEOUT:
       message+=F("TIMEOUT WAITING FOR SERVER");
       break;
+    case UPD_THROTTLED:
+      message+=F("THROTTLED (REQUEST BUDGET)");
+      break;
     default:
       message+="ERROR CODE (" + String(lastUpdateResult) + F(")");
       break;
@@ -1938,7 +2111,8 @@ void updateCurrentWeather() {
     weatherMsg[0] = toUpperCase(weatherMsg[0]);
     weatherMsg[sizeof(weatherMsg)-1] = '\0';
   } else {
-    nextWeatherUpdate = millis() + 30000; // Try again in 30s
+    unsigned long wait = apiBudget.getWait(UPSTREAM_WEATHER);
+    nextWeatherUpdate = millis() + (wait > 30000 ? wait : 30000); // Try again in 30s, or once the budget allows
   }
 }
 
@@ -1953,7 +2127,8 @@ void departureBoardLoop() {
   if ((millis() > nextDataUpdate) && (!isScrollingStops) && (!isScrollingService) && (lastUpdateResult != UPD_UNAUTHORISED) && (!isSleeping) && (wifiConnected)) {
     timer = millis() + 2000;
     if (getStationBoard()) {
-      if ((lastUpdateResult == UPD_SUCCESS) || (lastUpdateResult == UPD_NO_CHANGE && firstLoad)) drawStationBoard(); // Something changed so redraw the board.
+      if (firstLoad) drawStationBoard();
+      else if (lastUpdateResult == UPD_SUCCESS) refreshStationBoard(); // Something changed so redraw it
     } else if (lastUpdateResult == UPD_UNAUTHORISED) showTokenErrorScreen();
 	  else if (lastUpdateResult == UPD_DATA_ERROR) {
 	    if (noDataLoaded) showNoDataScreen();
@@ -1961,6 +2136,8 @@ void departureBoardLoop() {
 	  } else if (noDataLoaded) showNoDataScreen();
   } else if (weatherEnabled && (millis()>nextWeatherUpdate) && (!noDataLoaded) && (!isScrollingStops) && (!isScrollingService) && (!isSleeping) && (wifiConnected)) {
     updateCurrentWeather();
+  } else if (raildata->isEndpointStale() && (!noDataLoaded) && (!isScrollingStops) && (!isScrollingService) && (!isSleeping) && (wifiConnected)) {
+    raildata->refreshEndpoint();  // The cached SOAP endpoint is a week old, check it against the WSDL between updates
   }
 
   if (millis()>timer && numMessages && !isScrollingStops && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
@@ -1977,7 +2154,7 @@ void departureBoardLoop() {
 
   // Check if there's a via destination
   if (millis()>viaTimer) {
-    if (station.numServices && station.service[0].via[0] && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+    if (station->numServices && station->service[0].via[0] && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
       isShowingVia = !isShowingVia;
       drawPrimaryService(isShowingVia);
       u8g2.updateDisplayArea(0,1,32,3);
@@ -1987,7 +2164,7 @@ void departureBoardLoop() {
 
   if (millis()>serviceTimer && !isScrollingService && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     // Need to change to the next service if there is one
-    if (station.numServices <= 1 && !weatherMsg[0]) {
+    if (station->numServices <= 1 && !weatherMsg[0]) {
       // There's no other services and no weather so just so static attribution.
       drawServiceLine(1,LINE3);
       serviceTimer = millis() + 30000;
@@ -1995,8 +2172,8 @@ void departureBoardLoop() {
     } else {
       prevService = line3Service;
       line3Service++;
-      if (station.numServices) {
-        if ((line3Service>station.numServices && !weatherMsg[0]) || (line3Service>station.numServices+1 && weatherMsg[0])) line3Service=1;  // First 'other' service
+      if (station->numServices) {
+        if ((line3Service>station->numServices && !weatherMsg[0]) || (line3Service>station->numServices+1 && weatherMsg[0])) line3Service=1;  // First 'other' service
       } else {
         if (weatherMsg[0] && line3Service>1) line3Service=0;
       }
@@ -2084,26 +2261,26 @@ void undergroundArrivalsLoop() {
 
     // Scrolling the additional services
   if (millis()>serviceTimer && !isScrollingService && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
-    if (station.numServices<=2 && messages.numMessages==0) {
+    if (station->numServices<=2 && numMessages==0) {
       // There are no additional services to scroll in so static attribution.
       serviceTimer = millis() + 30000;
     } else {
       // Need to change to the next service or message if there is one
       prevService = line3Service;
       line3Service++;
-      if ((line3Service >= station.numServices && messages.numMessages==0) || (line3Service >= station.numServices+1 && messages.numMessages)) {
+      if ((line3Service >= station->numServices && numMessages==0) || (line3Service >= station->numServices+1 && numMessages)) {
         // Rollover
-        if (station.numServices>2) line3Service = 2; else line3Service = station.numServices;
+        if (station->numServices>2) line3Service = 2; else line3Service = station->numServices;
         prevMessage = currentMessage;
         prevScrollStopsLength = scrollStopsLength;  // Save the length of the previous message
       }
       scrollServiceYpos=11;
       scrollStopsXpos=0;
       isScrollingService = true;
-      if (line3Service>=station.numServices) {
+      if (line3Service>=station->numServices) {
         // Showing the messages
         currentMessage++;
-        if (currentMessage>=messages.numMessages) currentMessage=0; // Rollover
+        if (currentMessage>=numMessages) currentMessage=0; // Rollover
         scrollStopsLength = getStringWidth(line2[currentMessage]);
       } else {
         scrollStopsLength=SCREEN_WIDTH;
@@ -2117,14 +2294,14 @@ void undergroundArrivalsLoop() {
       // we're scrolling up the message initially
       u8g2.setClipWindow(0,ULINE3,256,ULINE3+10);
       // Was the previous display a service?
-      if (prevService<station.numServices) {
+      if (prevService<station->numServices) {
         drawUndergroundService(prevService,scrollServiceYpos+ULINE3-13);
       } else {
         // if the previous message didn't scroll then we need to scroll it up off the screen
         if (prevScrollStopsLength && prevScrollStopsLength<256) centreText(line2[prevMessage],scrollServiceYpos+ULINE3-13);
       }
       // Is this entry a service?
-      if (line3Service<station.numServices) {
+      if (line3Service<station->numServices) {
         drawUndergroundService(line3Service,scrollServiceYpos+ULINE3-1);
       } else {
         if (scrollStopsLength<256) centreText(line2[currentMessage],scrollServiceYpos+ULINE3-2); // Centre text if it fits
@@ -2133,7 +2310,7 @@ void undergroundArrivalsLoop() {
       u8g2.setMaxClipWindow();
       scrollServiceYpos--;
       if (scrollServiceYpos==0) {
-        if (line3Service<station.numServices) {
+        if (line3Service<station->numServices) {
           serviceTimer=millis()+3500;
           isScrollingService=false;
         } else {
@@ -2163,9 +2340,9 @@ void undergroundArrivalsLoop() {
     fullRefresh = true;
     // we're scrolling the primary service(s) into view
     u8g2.setClipWindow(0,ULINE1,256,ULINE1+10);
-    if (station.numServices) drawUndergroundService(0,scrollPrimaryYpos+ULINE1-1);
+    if (station->numServices) drawUndergroundService(0,scrollPrimaryYpos+ULINE1-1);
     else centreText(F("There are no scheduled arrivals at this station."),scrollPrimaryYpos+ULINE1-1);
-    if (station.numServices>1) {
+    if (station->numServices>1) {
       u8g2.setClipWindow(0,ULINE2,256,ULINE2+10);
       drawUndergroundService(1,scrollPrimaryYpos+ULINE2-1);
     }
@@ -2195,6 +2372,7 @@ void undergroundArrivalsLoop() {
 //
 void setup(void) {
   // These are the default wsdl XML SOAP entry points. They can be overridden in the config.json file if necessary
+  // (the SOAP request namespace follows the targetNamespace of whichever WSDL version is loaded)
   strncpy(wsdlHost,"lite.realtime.nationalrail.co.uk",sizeof(wsdlHost));
   strncpy(wsdlAPI,"/OpenLDBWS/wsdl.aspx?ver=2021-11-01",sizeof(wsdlAPI));
   u8g2.begin();                       // Start the OLED panel
@@ -2209,7 +2387,6 @@ void setup(void) {
   progressBar(F("Initialising Departures Board"),0);
 
   bool isFSMounted = LittleFS.begin(true);    // Start the File System, format if necessary
-  strcpy(station.location,"");                // No default location
   strcpy(weatherMsg,"");                      // No weather message
   strcpy(nrToken,"");                         // No default National Rail token
   loadApiKeys();                              // Load the API keys from the apiKeys.json
@@ -2254,6 +2431,7 @@ void setup(void) {
   WiFi.localIP().toString().toCharArray(ipBuff,sizeof(ipBuff));   // Get the IP address of the ESP32
   centreText(ipBuff,53);                                          // Display the IP address
   progressBar(F("Wi-Fi Connected"),40);
+  bootWiFiTime=millis();
   u8g2.sendBuffer();                                              // Send to OLED panel
 
   // Configure the local webserver paths
@@ -2266,6 +2444,7 @@ void setup(void) {
   server.onNotFound(handleNotFound);
   server.on(F("/cat"),handleCat);
   server.on(F("/del"),handleDelete);
+  server.on(F("/capture"),handleCaptureList);
   server.on(F("/reboot"),handleReboot);
   server.on(F("/stationpicker"),handleStationPicker);           // Used by the Web GUI to lookup station codes interactively
   server.on(F("/firmware"),handleFirmwareInfo);                 // Used by the Web GUI to display the running firmware version
@@ -2366,14 +2545,17 @@ void setup(void) {
     ESP.restart();
   }
 
-  station.numServices=0;
+  bootClockTime=millis();
+
   if (tubeMode) {
     tfldata = new TfLdataClient();
+    tfldata->setCapture(&capture);
     progressBar(F("Initialising TfL interface"),70);
     startupProgressPercent=70;
   } else {
     progressBar(F("Initialising National Rail interface"),60);
     raildata = new raildataXmlClient();
+    raildata->setCapture(&capture);
     int res = raildata->init(wsdlHost, wsdlAPI, &raildataCallback);
     if (res != UPD_SUCCESS) {
       showWsdlFailureScreen();
@@ -2381,6 +2563,7 @@ void setup(void) {
     }
     progressBar(F("Initialising National Rail interface"),70);
   }
+  bootInitTime=millis();
 }
 
 
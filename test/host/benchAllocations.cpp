@@ -0,0 +1,66 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - heap allocations made by raildataXmlClient::updateDepartures().
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+#include <new>
+
+static long allocations = 0;
+static long allocatedBytes = 0;
+
+void *operator new(size_t size) {
+    allocations++;
+    allocatedBytes += size;
+    void *p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+static void progress(int state, int id) {}
+
+// Runs one update against the given response, and reports what was allocated while it ran
+static int countUpdate(raildataXmlClient &client, const char *label, const std::string &response, rdStation *station, stnMessages *messages) {
+    hostResponses.push_back(hostHttpResponse(response));
+    delay(60000);   // Leave time for the request budget to refill
+    long startCount = allocations;
+    long startBytes = allocatedBytes;
+    int result = client.updateDepartures(station, messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+    printf("%-28s result %d  %5ld allocations  %7ld bytes  %d services\n", label, result, allocations - startCount, allocatedBytes - startBytes, station->numServices);
+    return result;
+}
+
+int main() {
+    static rdStation station;
+    static stnMessages messages;
+    std::string details = readDataFile("darwin_details.xml");
+    std::string board = readDataFile("darwin_board.xml");
+
+    // Start from the WSDL, not an endpoint cached by an earlier run
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient *client = new raildataXmlClient();
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    if (client->init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) != UPD_SUCCESS) {
+        printf("init failed\n");
+        return 1;
+    }
+
+    int first = countUpdate(*client, "First update (with details)", details, &station, &messages);
+    countUpdate(*client, "Board only, unchanged", board, &station, &messages);
+    countUpdate(*client, "Board only, unchanged", board, &station, &messages);
+    delay(DETAILREFRESHINTERVAL);
+    countUpdate(*client, "Details refresh", details, &station, &messages);
+    delete client;
+    return first == UPD_SUCCESS ? 0 : 1;
+}
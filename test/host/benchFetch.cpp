@@ -0,0 +1,105 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - time to fetch a board, and the bytes read for it, from a mock SOAP server that streams its response
+ * at WiFi rates. The whole board (with bus services) is compared with a board the client can stop reading early.
+ * A server that closes the connection after each response is compared with one that keeps it open, when the rest
+ * of the body is read (but not parsed) so the connection can be reused. TLS handshakes take no time here. If the
+ * build has zlib, the details are fetched gzip as well.
+ *
+ *   benchFetch [bytes per second] [ms to the first byte]
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+
+#define FETCHBYTESPERSECOND 25000   // A TLS stream to the ESP32 over WiFi
+#define FETCHFIRSTBYTEMS 300
+
+static void progress(int state, int id) {}
+
+struct fetchResult {
+    int result;
+    unsigned long ms;
+    unsigned long bytes;
+};
+
+static fetchResult fetch(raildataXmlClient *client, const std::string &response, int numRows, bool buses) {
+    static rdStation station;
+    static stnMessages messages;
+    hostResponses.push_back(response);
+    hostBytesRead = 0;
+    delay(60000);   // Leave time for the request budget to refill
+    unsigned long start = millis();
+    int result = client->updateDepartures(&station, &messages, "CLJ", "token", numRows, buses, "");
+    return { result, millis() - start, hostBytesRead };
+}
+
+int main(int argc, char **argv) {
+    const char *files[] = { "darwin_board.xml", "darwin_details.xml", "darwin_messages.xml" };
+    struct { const char *label; const char *headers; } servers[] = {
+        { "close", "Connection: close\r\n" },
+        { "keep-alive", "" },
+    };
+    struct { const char *label; int numRows; bool buses; } polls[] = {
+        { "all, with buses", MAXBOARDSERVICES, true },
+        { "all, no buses", MAXBOARDSERVICES, false },
+        { "3 rows, no buses", 3, false },
+    };
+
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient *client = new raildataXmlClient();
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    if (client->init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) != UPD_SUCCESS) {
+        printf("init failed\n");
+        return 1;
+    }
+    hostBytesPerSecond = argc > 1 ? atol(argv[1]) : FETCHBYTESPERSECOND;
+    hostFirstByteMs = argc > 2 ? atol(argv[2]) : FETCHFIRSTBYTEMS;
+    printf("%lu bytes/s, %lu ms to the first byte\n", hostBytesPerSecond, hostFirstByteMs);
+
+    printf("%-22s %-11s %-18s %10s %10s %8s\n", "File", "Server", "Poll", "Response", "Read", "ms");
+    for (auto &server : servers) {
+        for (const char *name : files) {
+            std::string response = hostHttpResponse(readDataFile(name), server.headers);
+            bool keepAlive = !server.headers[0];
+            hostKeepAlive = keepAlive;
+            fetchResult whole = { 0, 0, 0 };
+            for (auto &poll : polls) {
+                int connects = hostConnects;
+                fetchResult r = fetch(client, response, poll.numRows, poll.buses);
+                printf("%-22s %-11s %-18s %10zu %10lu %8lu\n", name, server.label, poll.label, response.size(), r.bytes, r.ms);
+                CHECK(r.result == UPD_SUCCESS || r.result == UPD_NO_CHANGE, "%s, %s: result %d %s", name, poll.label, r.result, client->getLastError().c_str());
+                if (poll.buses) {
+                    whole = r;
+                    CHECK(r.bytes + 100 >= response.size(), "%s: only %lu of %zu bytes read with buses", name, r.bytes, response.size());
+                } else if (keepAlive) {
+                    // The whole body is drained, so the next request goes out on the same connection
+                    CHECK(r.bytes == response.size(), "%s, %s: read %lu of %zu bytes on a kept connection", name, poll.label, r.bytes, response.size());
+                    CHECK(hostConnects == connects, "%s, %s: reconnected", name, poll.label);
+                } else {
+                    // Every file has its bus services after the trains, so they're never read
+                    CHECK(r.bytes < whole.bytes && r.ms < whole.ms, "%s, %s: read %lu bytes in %lu ms, %lu in %lu ms with buses", name, poll.label, r.bytes, r.ms, whole.bytes, whole.ms);
+                }
+            }
+        }
+    }
+#ifdef HOST_ZLIB
+    // The details again, gzip, on the kept connection
+    std::string gzip = hostHttpResponse(readDataFile("darwin_details.xml.gz"), "Content-Encoding: gzip\r\n");
+    fetchResult r = fetch(client, gzip, MAXBOARDSERVICES, true);
+    printf("%-22s %-11s %-18s %10zu %10lu %8lu\n", "darwin_details.xml.gz", "keep-alive", "all, with buses", gzip.size(), r.bytes, r.ms);
+    CHECK(r.result == UPD_SUCCESS || r.result == UPD_NO_CHANGE, "gzip: result %d %s", r.result, client->getLastError().c_str());
+    CHECK(r.bytes == gzip.size(), "gzip: read %lu of %zu bytes", r.bytes, gzip.size());
+#endif
+    delete client;
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
@@ -0,0 +1,110 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - httpInflater throughput on a gzip Darwin response: alone, feeding the XML parser, and in a whole
+ * board update. On the host the inflating is done by zlib rather than the ESP32 ROM's tinfl.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <httpInflater.h>
+#include <xmlStreamingParser.h>
+#include <raildataXmlClient.h>
+#include <LittleFS.h>
+
+static const char * const tagNames[DARWIN_TAG_COUNT] = { DARWIN_TAGS(DARWIN_TAG_NAME) };
+static const char * const namespaceURIs[DARWIN_NS_COUNT] = { DARWIN_NAMESPACES(DARWIN_TAG_NAME) };
+
+class nullListener : public xmlListener {
+    public:
+        int startTag(const char *tagName, const xmlTagStack &tags) { return XML_CONTINUE; }
+        int endTag(const char *tagName, const xmlTagStack &tags) { return XML_CONTINUE; }
+        void parameter(const char *param) {}
+        void valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags) {}
+        void attribute(const char *name, const char *value, const xmlTagStack &tags) {}
+};
+
+// Writes the body in blocks the size of the client's read buffer and reads back what's inflated, returning its length
+static size_t inflateBody(httpInflater &inflater, const std::string &body, uint8_t encoding, xmlStreamingParser *parser) {
+    size_t total = 0;
+    inflater.reset(encoding);
+    if (parser) parser->reset();
+    char buf[READBUFFERSIZE];
+    for (size_t pos = 0; pos < body.size(); pos += sizeof(buf)) {
+        size_t length = std::min(sizeof(buf), body.size() - pos);
+        memcpy(buf, body.data() + pos, length);
+        inflater.write(buf, length);
+        char *out;
+        size_t n;
+        while ((n = inflater.read(&out)) > 0) {
+            total += n;
+            if (parser) parser->parse(out, n);
+        }
+    }
+    return total;
+}
+
+static void progress(int state, int id) {}
+
+int main() {
+#ifndef HOST_ZLIB
+    printf("Built without zlib, skipped\n");
+    return 0;
+#endif
+    std::string xml = readDataFile("darwin_details.xml");
+    std::string gz = readDataFile("darwin_details.xml.gz");
+    int failed = 0;
+
+    httpInflater inflater;
+    if (!inflater.begin()) return 1;
+    nullListener listener;
+    xmlStreamingParser parser;
+    parser.setListener(&listener);
+    parser.setTagTable(tagNames, DARWIN_TAG_COUNT);
+    parser.setNamespaceTable(namespaceURIs, DARWIN_NS_COUNT);
+
+    size_t inflated = inflateBody(inflater, gz, ENCODING_GZIP, &parser);
+    if (inflated != xml.size() || !inflater.isComplete() || !parser.isDocumentComplete()) {
+        printf("Inflated %zu of %zu bytes, complete %d, document complete %d\n", inflated, xml.size(), inflater.isComplete(), parser.isDocumentComplete());
+        failed++;
+    }
+
+    printf("darwin_details.xml: %zu bytes, %zu gzip (%.1fx)\n\n", xml.size(), gz.size(), (double)xml.size() / gz.size());
+    printf("%-24s %12s %12s\n", "", "us", "MB/s out");
+    double secs = timeRun([&]() { inflateBody(inflater, gz, ENCODING_GZIP, nullptr); }, nullptr);
+    printf("%-24s %12.1f %12.1f\n", "inflate", secs * 1e6, xml.size() / secs / 1e6);
+    secs = timeRun([&]() { inflateBody(inflater, gz, ENCODING_GZIP, &parser); }, nullptr);
+    printf("%-24s %12.1f %12.1f\n", "inflate + parse", secs * 1e6, xml.size() / secs / 1e6);
+    secs = timeRun([&]() { inflateBody(inflater, xml, ENCODING_IDENTITY, &parser); }, nullptr);
+    printf("%-24s %12.1f %12.1f\n", "parse (identity)", secs * 1e6, xml.size() / secs / 1e6);
+    inflater.end();
+
+    // Whole updates. After the first, the board is unchanged, but every response is still read in full.
+    static rdStation station;
+    static stnMessages messages;
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient client;
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress);
+    const char *labels[] = { "update, identity", "update, gzip" };
+    for (int compressed = 1; compressed >= 0; compressed--) {
+        std::string response = compressed ? hostHttpResponse(gz, "Content-Encoding: gzip\r\n") : hostHttpResponse(xml);
+        int result = UPD_SUCCESS;
+        secs = timeRun([&]() {
+            hostResponses.push_back(response);
+            delay(60000);   // Leave time for the request budget to refill
+            int r = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+            if (r != UPD_SUCCESS && r != UPD_NO_CHANGE) result = r;
+        }, nullptr);
+        printf("%-24s %12.1f %12.1f\n", labels[compressed], secs * 1e6, xml.size() / secs / 1e6);
+        if (result != UPD_SUCCESS) {
+            printf("%s failed (%d) %s\n", labels[compressed], result, client.getLastError().c_str());
+            failed++;
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,115 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - textNormaliser against the functions it replaced (sanitiseText, pruneFromPhrase and fixFullStop in
+ * raildataXmlClient, replaceWord in TfLdataClient), timed over the normaliser corpus. With --golden it writes
+ * what the old functions made of the corpus, which is kept as data/normaliser_golden.txt.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <normaliserCorpus.h>
+
+// The old functions, as they were before textNormaliser, working on plain buffers rather than the text arena
+static void sanitiseText(char *input, bool isMessage) {
+    char *output = input;
+    char *p = input;
+    while (*p) {
+        if (*p == '<') {
+            char *tagEnd = strchr(p, '>');
+            if (!tagEnd) break;
+            if ((p[1] == 'b' || p[1] == 'B') && (p[2] == 'r' || p[2] == 'R') && (p[3] == '>' || p[3] == '/' || p[3] == ' ')) *output++ = ' ';
+            p = tagEnd + 1;
+        } else if (isMessage && *p == '&' && strncmp(p, "&amp;", 5) == 0) {
+            *output++ = '&';
+            p += 5;
+        } else if (isMessage && *p == '&' && strncmp(p, "&quot;", 6) == 0) {
+            *output++ = '\"';
+            p += 6;
+        } else if (isMessage && !isprint((unsigned char)*p)) {
+            p++;
+        } else {
+            *output++ = *p++;
+        }
+    }
+    *output = '\0';
+}
+
+static void pruneFromPhrase(char *input, const char *target) {
+    char *pos = strstr(input, target);
+    if (pos) *pos = '\0';
+}
+
+static void fixFullStop(char *input) {
+    size_t len = strlen(input);
+    if (!len) return;
+    while (len && (input[len-1] == '.' || input[len-1] == ' ')) input[--len] = '\0';
+    if (len < MAXMESSAGESIZE-1) strcpy(input + len, ".");
+}
+
+static void replaceWord(char *input, const char *target, const char *replacement) {
+    char *pos = strstr(input, target);
+    while (pos) {
+        size_t targetLen = strlen(target);
+        memmove(pos + strlen(replacement), pos + targetLen, strlen(pos + targetLen) + 1);
+        memcpy(pos, replacement, strlen(replacement));
+        pos = strstr(pos + strlen(replacement), target);
+    }
+}
+
+static void oldText(char *text, int mode) {
+    switch (mode) {
+        case MODE_FIELD: sanitiseText(text, false); break;
+        case MODE_TFL: replaceWord(text, "\\n", ""); break;
+        default:
+            sanitiseText(text, true);
+            if (mode == MODE_STATION) {
+                for (const char *phrase : stationMessageEnds) pruneFromPhrase(text, phrase);
+            }
+            fixFullStop(text);
+    }
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> corpus = readCorpus();
+    static char buf[MAXMESSAGESIZE * 4];
+
+    if (argc > 1 && strcmp(argv[1], "--golden") == 0) {
+        for (const std::string &item : corpus) {
+            for (int mode = 0; mode < MODE_COUNT; mode++) {
+                strcpy(buf, item.c_str());
+                oldText(buf, mode);
+                printf("%s %s\n", modeNames[mode], escapeText(buf).c_str());
+            }
+        }
+        return 0;
+    }
+
+    size_t bytes = 0;
+    for (const std::string &item : corpus) bytes += item.size();
+    printf("%zu items, %zu bytes, each tidied in every mode\n\n", corpus.size(), bytes);
+    printf("%-10s %12s %12s\n", "", "old us", "new us");
+    double oldTotal = 0, newTotal = 0;
+    for (int mode = 0; mode < MODE_COUNT; mode++) {
+        double oldSecs = timeRun([&]() {
+            for (const std::string &item : corpus) {
+                memcpy(buf, item.c_str(), item.size() + 1);
+                oldText(buf, mode);
+            }
+        }, nullptr);
+        double newSecs = timeRun([&]() {
+            for (const std::string &item : corpus) {
+                memcpy(buf, item.c_str(), item.size() + 1);
+                normaliseText(buf, mode);
+            }
+        }, nullptr);
+        printf("%-10s %12.2f %12.2f\n", modeNames[mode], oldSecs * 1e6, newSecs * 1e6);
+        oldTotal += oldSecs;
+        newTotal += newSecs;
+    }
+    printf("%-10s %12.2f %12.2f\n", "all", oldTotal * 1e6, newTotal * 1e6);
+    return 0;
+}
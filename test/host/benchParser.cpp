@@ -0,0 +1,111 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - XML parser throughput on sample Darwin responses. The parser is fed by character and in bulk, with
+ * its listener called through xmlListener or directly as a template parameter, and skipping the subtrees that
+ * raildataXmlClient skips.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <xmlStreamingParser.h>
+#include <raildataXmlClient.h>
+
+static const char * const tagNames[DARWIN_TAG_COUNT] = { DARWIN_TAGS(DARWIN_TAG_NAME) };
+static const char * const namespaceURIs[DARWIN_NS_COUNT] = { DARWIN_NAMESPACES(DARWIN_TAG_NAME) };
+
+// Counts the events. With hashing on, it also hashes them so the two ways of feeding the parser can be checked against each other.
+// With skipping on, it skips what raildataXmlClient does once it has the first service.
+// It's final, so a BasicXmlParser<countingListener> calls it directly while xmlStreamingParser goes through the vtable.
+class countingListener final : public xmlListener {
+    public:
+        bool hashing = false;
+        bool skipping = false;
+        int services = 0;
+        long events = 0;
+        uint32_t hash = 2166136261UL;
+
+        void add(const char *text, size_t length, uint32_t extra) {
+            events++;
+            if (!hashing) return;
+            for (size_t i = 0; i < length; i++) hash = (hash ^ (uint8_t)text[i]) * 16777619UL;
+            hash = (hash ^ extra) * 16777619UL;
+        }
+        int startTag(const char *tagName, const xmlTagStack &tags) {
+            add(tagName, strlen(tagName), tags.current());
+            if (!skipping) return XML_CONTINUE;
+            const char *localName = strchr(tagName, ':');
+            if (strcmp(localName ? localName + 1 : tagName, "service") == 0) services++;
+            switch (tags.current()) {
+                case TAG_PREVIOUSCALLINGPOINTS:
+                    return XML_SKIP;
+                case TAG_SUBSEQUENTCALLINGPOINTS:
+                case TAG_FORMATION:
+                    if (services > 1) return XML_SKIP;
+                    break;
+            }
+            return XML_CONTINUE;
+        }
+        int endTag(const char *tagName, const xmlTagStack &tags) { add(tagName, strlen(tagName), tags.depth); return XML_CONTINUE; }
+        void parameter(const char *param) {}
+        void valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags) { add(value, length, last); }
+        void attribute(const char *name, const char *value, const xmlTagStack &tags) { add(name, strlen(name), 0); add(value, strlen(value), 1); }
+};
+
+// Feeds the document in blocks the size of the clients' read buffer, one character at a time or in bulk
+template<class Parser> void parseDocument(Parser &parser, countingListener &listener, const std::string &doc, bool bulk) {
+    parser.reset();
+    listener.services = 0;
+    for (size_t pos = 0; pos < doc.size(); pos += 512) {
+        size_t length = std::min<size_t>(512, doc.size() - pos);
+        if (bulk) parser.parse(doc.data() + pos, length);
+        else for (size_t i = 0; i < length; i++) parser.parse(doc[pos + i]);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *defaults[] = { "darwin_details.xml", "darwin_board.xml" };
+    int files = argc > 1 ? argc - 1 : 2;
+    bool identical = true;
+
+    printf("%-20s %-10s %10s %12s %14s %10s\n", "File", "Path", "Bytes", "MB/s", "Events/s", "us/parse");
+    for (int f = 0; f < files; f++) {
+        const char *name = argc > 1 ? argv[f + 1] : defaults[f];
+        std::string doc = readDataFile(name);
+        uint32_t hash[4];
+        for (int path = 0; path < 4; path++) {
+            static const char * const pathNames[] = { "per char", "bulk", "template", "skipping" };
+            bool bulk = path > 0;
+            countingListener listener;
+            listener.skipping = path == 3;
+            xmlStreamingParser virtualParser;
+            BasicXmlParser<countingListener> directParser;
+            virtualParser.setListener(&listener);
+            virtualParser.setTagTable(tagNames, DARWIN_TAG_COUNT);
+            virtualParser.setNamespaceTable(namespaceURIs, DARWIN_NS_COUNT);
+            directParser.setListener(&listener);
+            directParser.setTagTable(tagNames, DARWIN_TAG_COUNT);
+            directParser.setNamespaceTable(namespaceURIs, DARWIN_NS_COUNT);
+            auto run = [&]() {
+                if (path == 2) parseDocument(directParser, listener, doc, bulk);
+                else parseDocument(virtualParser, listener, doc, bulk);
+            };
+            listener.hashing = true;
+            run();
+            listener.hashing = false;
+            long events = listener.events;
+            hash[path] = listener.hash;
+            double secs = timeRun(run, nullptr);
+            printf("%-20s %-10s %10zu %12.1f %14.0f %10.1f\n", name, pathNames[path], doc.size(), doc.size() / secs / 1e6, events / secs, secs * 1e6);
+        }
+        if (hash[0] != hash[1] || hash[0] != hash[2]) {
+            printf("%s: the events from the per char, bulk and template paths differ\n", name);
+            identical = false;
+        }
+    }
+    return identical ? 0 : 1;
+}
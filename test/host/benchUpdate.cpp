@@ -0,0 +1,53 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - time taken by raildataXmlClient::updateDepartures() to read, tidy and publish a board.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+
+static void progress(int state, int id) {}
+
+int main(int argc, char **argv) {
+    static rdStation station;
+    static stnMessages messages;
+    const char *defaults[] = { "darwin_details.xml", "darwin_board.xml", "darwin_messages.xml" };
+    int files = argc > 1 ? argc - 1 : 3;
+
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient *client = new raildataXmlClient();
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    if (client->init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) != UPD_SUCCESS) {
+        printf("init failed\n");
+        return 1;
+    }
+
+    int failed = 0;
+    printf("%-22s %10s %12s\n", "File", "Bytes", "us/update");
+    for (int f = 0; f < files; f++) {
+        const char *name = argc > 1 ? argv[f + 1] : defaults[f];
+        std::string response = hostHttpResponse(readDataFile(name));
+        int result = UPD_SUCCESS;
+        double secs = timeRun([&]() {
+            hostResponses.push_back(response);
+            delay(60000);   // Leave time for the request budget to refill
+            int r = client->updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+            if (r != UPD_SUCCESS && r != UPD_NO_CHANGE) result = r;
+        }, nullptr);
+        printf("%-22s %10zu %12.1f\n", name, response.size(), secs * 1e6);
+        if (result != UPD_SUCCESS) {
+            printf("%s: update failed (%d) %s\n", name, result, client->getLastError().c_str());
+            failed++;
+        }
+    }
+    delete client;
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - helpers shared by the host tests and benchmarks.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+// Checks that fail are counted and reported, and the test's exit status is the number that failed
+inline int checkFailures = 0;
+#define CHECK(condition, ...) do { \
+    if (!(condition)) { \
+        checkFailures++; \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+// Reads a file from test/host/data (or the path given, if it has a directory)
+inline std::string readDataFile(const char *name) {
+    std::string path = strchr(name, '/') ? std::string(name) : std::string(HOST_DATA_DIR "/") + name;
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "Can't read %s\n", path.c_str());
+        exit(2);
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// Seconds taken by the fastest of a few runs of fn, each of which repeats it enough times to take ~50ms
+template<class Fn> double timeRun(Fn fn, long *repeats) {
+    typedef std::chrono::steady_clock clock;
+    long n = 1;
+    for (;;) {
+        clock::time_point start = clock::now();
+        for (long i = 0; i < n; i++) fn();
+        if (std::chrono::duration<double>(clock::now() - start).count() > 0.05) break;
+        n *= 2;
+    }
+    double best = 1e9;
+    for (int run = 0; run < 5; run++) {
+        clock::time_point start = clock::now();
+        for (long i = 0; i < n; i++) fn();
+        double secs = std::chrono::duration<double>(clock::now() - start).count() / n;
+        if (secs < best) best = secs;
+    }
+    if (repeats) *repeats = n;
+    return best;
+}
@@ -0,0 +1,75 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the text normaliser corpus, and the ways the clients tidy text with it, shared by the golden test
+ * and the benchmark that writes the golden output.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <hostTest.h>
+#include <textNormaliser.h>
+#include <stationData.h>
+#include <vector>
+
+// How each kind of text is tidied, in the order its golden lines are written
+enum { MODE_FIELD, MODE_MESSAGE, MODE_STATION, MODE_TFL, MODE_COUNT };
+static const char * const modeNames[MODE_COUNT] = { "field", "message", "station", "tfl" };
+
+// As raildataXmlClient and TfLdataClient set up their normalisers
+static const char * const stationMessageEnds[] = { " More details ", " Latest information ", " Further information " };
+static textNormaliser fieldText(TEXT_MARKUP);
+static textNormaliser messageText(TEXT_MESSAGE);
+static textNormaliser stationMessageText(TEXT_MESSAGE, stationMessageEnds, 3);
+static textNormaliser tflMessageText(TEXT_ESCAPES);
+
+// Tidies text (which has room for a fullstop) as the client does, as raildataXmlClient::finishMessage() for messages
+inline void normaliseText(char *text, int mode) {
+    switch (mode) {
+        case MODE_FIELD: fieldText.normalise(text); break;
+        case MODE_TFL: tflMessageText.normalise(text); break;
+        default:
+            size_t length = (mode == MODE_STATION ? stationMessageText : messageText).normalise(text);
+            if (length && length < MAXMESSAGESIZE-1) strcpy(text + length, ".");
+    }
+}
+
+// The corpus lines with their \xHH escapes decoded
+inline std::vector<std::string> readCorpus() {
+    std::vector<std::string> items;
+    std::istringstream lines(readDataFile("normaliser_corpus.txt"));
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::string item;
+        for (size_t i = 0; i < line.size(); i++) {
+            if (line[i] == '\\' && i + 3 < line.size() && line[i+1] == 'x' && isxdigit((unsigned char)line[i+2]) && isxdigit((unsigned char)line[i+3])) {
+                item += (char)strtol(line.substr(i + 2, 2).c_str(), nullptr, 16);
+                i += 3;
+            } else {
+                item += line[i];
+            }
+        }
+        items.push_back(item);
+    }
+    return items;
+}
+
+// Text with its non-printing characters written as \xHH, as in the corpus
+inline std::string escapeText(const std::string &text) {
+    std::string out;
+    char hex[8];
+    for (unsigned char c : text) {
+        if (isprint(c)) {
+            out += (char)c;
+        } else {
+            snprintf(hex, sizeof(hex), "\\x%02x", c);
+            out += hex;
+        }
+    }
+    return out;
+}
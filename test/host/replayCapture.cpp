@@ -0,0 +1,157 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - replays responses kept by responseCapture through the clients, and prints the boards they make.
+ *
+ *   replayCapture <directory>          the files downloaded from /capture, with its index.txt, oldest first
+ *   replayCapture <file>...            Darwin responses, gzip if the name ends .gz
+ *
+ * Each body is sent back as the response to every request the client makes, with the Content-Encoding it was
+ * captured with. TfL captures are only replayed when the TfL client is built, which needs JSONSTREAMINGPARSER_DIR
+ * (see CMakeLists.txt). The exit status is the number of responses that didn't make a board.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <LittleFS.h>
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+#ifdef HOST_TFL
+#include <TfLdataClient.h>
+#endif
+
+struct replayFile {
+    unsigned long sequence;
+    std::string path;
+    std::string source;
+    bool compressed;
+    bool truncated;
+};
+
+static void progress(int state, int id) {}
+#ifdef HOST_TFL
+static void tflProgress() {}
+#endif
+
+static std::string captureResponse(const replayFile &capture) {
+    return hostHttpResponse(readDataFile(capture.path.c_str()), capture.compressed ? "Content-Encoding: gzip\r\n" : "");
+}
+
+static void printBoard(const rdStation &station, const stnMessages &messages) {
+    printf("  %s, %d services\n", station.location, station.numServices);
+    for (int i = 0; i < station.numServices; i++) {
+        const rdService &s = station.service[i];
+        printf("  %-5s %-5s %-3s %-30s %s\n", s.sTime[0] ? s.sTime : s.sta, s.serviceType == BUS ? "bus" : "", s.platform, s.destination, s.sTime[0] ? s.etd : s.eta);
+    }
+    if (station.calling[0]) printf("  Calling at: %s\n", station.calling);
+    if (station.serviceMessage[0]) printf("  %s\n", station.serviceMessage);
+    for (int i = 0; i < messages.numMessages; i++) printf("  Message: %s\n", messages.messages[i]);
+}
+
+static int replayDarwin(const replayFile &capture) {
+    static rdStation station;
+    static stnMessages messages;
+    memset(&station, 0, sizeof(station));
+    memset(&messages, 0, sizeof(messages));
+
+    // A new client each time, so the board is read in full rather than compared with the last one
+    LittleFS.remove(WSDLCACHEFILE);
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    raildataXmlClient client;
+    client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress);
+    std::string response = captureResponse(capture);
+    hostResponder = [&](const std::string &request) { return response; };
+    delay(60000);   // Leave time for the request budget to refill
+    int result = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+    hostResponder = nullptr;
+    printf("  result %d %s\n", result, client.getLastError().c_str());
+    if (result != UPD_SUCCESS) return 1;
+    printBoard(station, messages);
+    return 0;
+}
+
+#ifdef HOST_TFL
+// The arrivals are replayed with the status capture that follows them, if there is one
+static int replayTfL(const replayFile &capture, const replayFile *status) {
+    static rdStation station;
+    static stnMessages messages;
+    memset(&station, 0, sizeof(station));
+    memset(&messages, 0, sizeof(messages));
+
+    TfLdataClient client;
+    std::string arrivals = captureResponse(capture);
+    std::string statusResponse = status ? captureResponse(*status) : hostHttpResponse("[]");
+    hostResponder = [&](const std::string &request) { return request.find("/Arrivals") != std::string::npos ? arrivals : statusResponse; };
+    delay(60000);
+    int result = client.updateArrivals(&station, &messages, "940GZZLUCPN", "key", tflProgress);
+    hostResponder = nullptr;
+    printf("  result %d %s\n", result, client.lastErrorMsg.c_str());
+    if (result != UPD_SUCCESS && result != UPD_NO_CHANGE) return 1;
+    printBoard(station, messages);
+    return 0;
+}
+#endif
+
+// The captures listed in a directory's index.txt, oldest first
+static std::vector<replayFile> readIndex(const std::string &dir) {
+    std::vector<replayFile> files;
+    std::istringstream lines(readDataFile((dir + "/index.txt").c_str()));
+    std::string line;
+    while (std::getline(lines, line)) {
+        int n, truncated, compressed;
+        unsigned long sequence, bytes;
+        char source[MAXCAPTURESOURCESIZE];
+        if (sscanf(line.c_str(), "%d %lu %lu %d %d %11s", &n, &sequence, &bytes, &truncated, &compressed, source) != 6) continue;
+        std::string path = dir + "/" + std::to_string(n) + (compressed ? ".gz" : ".txt");
+        if (!std::filesystem::exists(path)) {
+            printf("%s is in the index but wasn't downloaded\n", path.c_str());
+            continue;
+        }
+        files.push_back({ sequence, path, source, compressed != 0, truncated != 0 });
+    }
+    std::sort(files.begin(), files.end(), [](const replayFile &a, const replayFile &b) { return a.sequence < b.sequence; });
+    return files;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        printf("Usage: %s <capture directory> | <file>...\n", argv[0]);
+        return 2;
+    }
+    std::vector<replayFile> files;
+    if (argc == 2 && std::filesystem::is_directory(argv[1])) {
+        files = readIndex(argv[1]);
+    } else {
+        for (int i = 1; i < argc; i++) {
+            std::string path = std::filesystem::absolute(argv[i]).string();
+            bool compressed = path.size() > 3 && path.compare(path.size() - 3, 3, ".gz") == 0;
+            files.push_back({ (unsigned long)i, path, "darwin", compressed, false });
+        }
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < files.size(); i++) {
+        const replayFile &capture = files[i];
+        printf("%s (%s%s%s)\n", capture.path.c_str(), capture.source.c_str(), capture.compressed ? ", gzip" : "", capture.truncated ? ", truncated" : "");
+        if (capture.source == "darwin") {
+            failed += replayDarwin(capture);
+        } else if (capture.source == "tflarrivals") {
+#ifdef HOST_TFL
+            const replayFile *status = (i + 1 < files.size() && files[i + 1].source == "tflstatus") ? &files[i + 1] : nullptr;
+            failed += replayTfL(capture, status);
+            if (status) i++;
+#else
+            printf("  skipped, the TfL client isn't built (set JSONSTREAMINGPARSER_DIR)\n");
+#endif
+        } else {
+            printf("  skipped, only replayed with the arrivals before it\n");
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,25 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - sizes of the board structures and the National Rail client. Most of each is char arrays, so the
+ * sizes are close to the ESP32's, but pointers here are 8 bytes rather than 4 and the stand-in WiFiClientSecure
+ * is smaller than the real one.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+
+int main() {
+    printf("%-22s %6zu\n", "rdStation", sizeof(rdStation));
+    printf("%-22s %6zu\n", "stnMessages", sizeof(stnMessages));
+    printf("%-22s %6zu\n", "stnBoard", sizeof(stnBoard));
+    printf("%-22s %6zu\n", "textArena", sizeof(textArena));
+    printf("%-22s %6zu\n", "WiFiClientSecure", sizeof(WiFiClientSecure));
+    printf("%-22s %6zu\n", "raildataXmlClient", sizeof(raildataXmlClient));
+    return 0;
+}
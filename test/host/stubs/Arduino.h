@@ -0,0 +1,112 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the parts of the Arduino core used by the libraries, for building them on a PC.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+typedef uint8_t byte;
+
+// Flash strings are ordinary strings on the host
+#define PROGMEM
+#define F(x) x
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+
+#define log_e(...)
+#define log_i(...)
+#define log_d(...)
+
+//
+// Arduino String, backed by std::string. Only what the libraries use is here.
+//
+class String {
+    public:
+        std::string s;
+
+        String() {}
+        String(const char *c) : s(c ? c : "") {}
+        String(const std::string &c) : s(c) {}
+        String(char c) : s(1, c) {}
+        String(int v) : s(std::to_string(v)) {}
+        String(long v) : s(std::to_string(v)) {}
+        String(unsigned int v) : s(std::to_string(v)) {}
+        String(unsigned long v) : s(std::to_string(v)) {}
+        String(float v) : s(std::to_string(v)) {}
+        String(double v) : s(std::to_string(v)) {}
+
+        unsigned int length() const { return s.size(); }
+        const char *c_str() const { return s.c_str(); }
+        bool startsWith(const String &p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+        bool endsWith(const String &p) const { return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0; }
+        int indexOf(const String &p, unsigned int from = 0) const { size_t r = s.find(p.s, from); return r == std::string::npos ? -1 : (int)r; }
+        int indexOf(char c, unsigned int from = 0) const { size_t r = s.find(c, from); return r == std::string::npos ? -1 : (int)r; }
+        String substring(unsigned int from) const { return from > s.size() ? String() : String(s.substr(from)); }
+        String substring(unsigned int from, unsigned int to) const { return from > s.size() ? String() : String(s.substr(from, to - from)); }
+        long toInt() const { return atol(s.c_str()); }
+        float toFloat() const { return atof(s.c_str()); }
+        void toCharArray(char *buf, unsigned int size) const { if (size) { strncpy(buf, s.c_str(), size); buf[size - 1] = '\0'; } }
+        void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+        void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+        void trim() { while (s.size() && isspace((unsigned char)s.back())) s.pop_back(); size_t i = 0; while (i < s.size() && isspace((unsigned char)s[i])) i++; s.erase(0, i); }
+        void toLowerCase() { for (char &c : s) c = tolower((unsigned char)c); }
+        bool equalsIgnoreCase(const String &o) const { return s.size() == o.s.size() && std::equal(s.begin(), s.end(), o.s.begin(), [](char a, char b) { return tolower((unsigned char)a) == tolower((unsigned char)b); }); }
+        char operator[](unsigned int i) const { return s[i]; }
+        char charAt(unsigned int i) const { return s[i]; }
+
+        String &operator+=(const String &o) { s += o.s; return *this; }
+        String &operator+=(const char *o) { s += o; return *this; }
+        String &operator+=(char c) { s += c; return *this; }
+        bool operator==(const String &o) const { return s == o.s; }
+        bool operator==(const char *o) const { return s == o; }
+        bool operator!=(const String &o) const { return s != o.s; }
+        bool operator!=(const char *o) const { return s != o; }
+        friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+        friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+        friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.s); }
+        friend String operator+(const String &a, char b) { return String(a.s + b); }
+};
+
+// Stream interface, as read by the HTTP clients
+class Stream {
+    public:
+        virtual ~Stream() {}
+        virtual int available() = 0;
+        virtual String readStringUntil(char terminator) = 0;
+};
+
+// Time runs from the start of the program. delay() doesn't wait, it moves the clock on instead.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long max);
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// glibc only has strlcpy from 2.38
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+inline size_t strlcpy(char *dest, const char *src, size_t size) {
+    size_t length = strlen(src);
+    if (size) {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dest, src, n);
+        dest[n] = '\0';
+    }
+    return length;
+}
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - LittleFS stand-in that keeps its files in a directory of the build tree.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sys/stat.h>
+
+class File {
+    public:
+        FILE *f = nullptr;
+
+        File() {}
+        File(FILE *file) : f(file) {}
+        operator bool() const { return f != nullptr; }
+        String readStringUntil(char terminator) { std::string s; int c; while (f && (c = fgetc(f)) != EOF && c != terminator) s += (char)c; return String(s); }
+        size_t print(const String &s) { return f ? fwrite(s.c_str(), 1, s.length(), f) : 0; }
+        size_t write(const uint8_t *buf, size_t size) { return f ? fwrite(buf, 1, size, f) : 0; }
+        int read() { return f ? fgetc(f) : -1; }
+        size_t read(uint8_t *buf, size_t size) { return f ? fread(buf, 1, size, f) : 0; }
+        int available() { return size() - position(); }
+        size_t size() { if (!f) return 0; long p = ftell(f); fseek(f, 0, SEEK_END); long e = ftell(f); fseek(f, p, SEEK_SET); return e; }
+        bool seek(size_t p) { return f && fseek(f, p, SEEK_SET) == 0; }
+        size_t position() { return f ? ftell(f) : 0; }
+        template<typename... Args> size_t printf(const char *format, Args... args) { return f ? fprintf(f, format, args...) : 0; }
+        void flush() { if (f) fflush(f); }
+        void close() { if (f) fclose(f); f = nullptr; }
+};
+
+class LittleFSClass {
+    public:
+        std::string root = HOST_FS_DIR;
+
+        std::string path(const String &p) { return root + p.c_str(); }
+        File open(const String &p, const char *mode) { std::string m(mode); return File(fopen(path(p).c_str(), m == "w" ? "wb" : m == "a" ? "ab" : m == "r+" ? "r+b" : "rb")); }
+        bool exists(const String &p) { struct stat st; return stat(path(p).c_str(), &st) == 0; }
+        bool remove(const String &p) { return ::remove(path(p).c_str()) == 0; }
+        bool mkdir(const String &p) { return ::mkdir(path(p).c_str(), 0755) == 0; }
+        bool rename(const String &from, const String &to) { return ::rename(path(from).c_str(), path(to).c_str()) == 0; }
+        size_t totalBytes() { return 131072; }   // The size of the spiffs partition
+        size_t usedBytes() { return 20480; }
+};
+
+extern LittleFSClass LittleFS;
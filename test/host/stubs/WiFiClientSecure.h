@@ -0,0 +1,64 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - TLS client stand-in that serves canned HTTP responses, one per request sent.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+#include <functional>
+
+extern std::deque<std::string> hostResponses;  // Served in order, one for each complete request written
+extern std::function<std::string(const std::string &request)> hostResponder;   // If set, answers requests instead
+extern std::vector<std::string> hostRequests;  // Every request written, headers and body
+extern int hostConnects;
+extern bool hostKeepAlive;  // The server leaves the connection open after a response
+extern bool hostStale;      // The server has silently dropped the connection, so the next request gets nothing
+extern unsigned long hostBytesPerSecond;   // If set, responses arrive at this rate on the millis() clock...
+extern unsigned long hostFirstByteMs;      // ...after this long
+extern unsigned long hostBytesRead;        // Response bytes read by clients
+
+// Builds a 200 response with a Content-Length
+std::string hostHttpResponse(const std::string &body, const char *extraHeaders = "");
+
+class WiFiClient : public Stream {
+    public:
+        std::string rx;
+        size_t pos = 0;
+        bool open = false;
+        std::string tx;
+
+        virtual ~WiFiClient() {}
+        int connect(const char *host, int port) { open = true; rx.clear(); pos = 0; hostConnects++; return 1; }
+        void setInsecure() {}
+        void setTimeout(int) {}
+        void setNoDelay(bool) {}
+        size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+        size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+        size_t write(const uint8_t *buf, size_t size);
+        size_t rxFrom = 0;          // Where the latest response starts in rx...
+        unsigned long rxSent = 0;   // ...and when it was sent
+
+        int available() { return arrived() - pos; }
+        int read() { if (pos >= arrived()) return -1; hostBytesRead++; return (uint8_t)rx[pos++]; }
+        // Reads come back a little short of what was asked for, so responses arrive split at odd places
+        int read(uint8_t *buf, size_t size) { size_t n = std::min(size, arrived() - pos); if (n > 37) n = n * 3 / 4; memcpy(buf, rx.data() + pos, n); pos += n; hostBytesRead += n; return n; }
+        int peek() { return pos < arrived() ? (uint8_t)rx[pos] : -1; }
+        String readStringUntil(char terminator);
+        bool connected() { return open && (hostKeepAlive || pos < rx.size()); }
+        void stop() { open = false; }
+        void clear() {}
+        operator bool() { return open; }
+
+    private:
+        size_t arrived();           // The end of what's been received so far
+};
+
+class WiFiClientSecure : public WiFiClient {};
@@ -0,0 +1,34 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the parts of the Arduino core used by the libraries, for building them on a PC.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <Arduino.h>
+#include <chrono>
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static unsigned long delayed = 0;     // Time added by delay()
+
+unsigned long millis() {
+    return delayed + std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+    return delayed * 1000UL + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms) {
+    delayed += ms;
+}
+
+void yield() {}
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the canned HTTP server behind WiFiClientSecure, and the LittleFS instance.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+
+std::deque<std::string> hostResponses;
+std::function<std::string(const std::string &request)> hostResponder;
+std::vector<std::string> hostRequests;
+int hostConnects = 0;
+bool hostKeepAlive = false;
+bool hostStale = false;
+unsigned long hostBytesPerSecond = 0;
+unsigned long hostFirstByteMs = 0;
+unsigned long hostBytesRead = 0;
+LittleFSClass LittleFS;
+
+std::string hostHttpResponse(const std::string &body, const char *extraHeaders) {
+    return "HTTP/1.1 200 OK\r\nContent-Type: text/xml\r\n" + std::string(extraHeaders) + "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size) {
+    if (!open) return 0;
+    tx.append((const char *)buf, size);
+    // A request is complete at the end of its headers, plus the body if it has a Content-Length
+    size_t headersEnd = tx.find("\r\n\r\n");
+    if (headersEnd == std::string::npos) return size;
+    size_t contentLength = 0;
+    size_t p = tx.find("Content-Length: ");
+    if (p != std::string::npos && p < headersEnd) contentLength = atoi(tx.c_str() + p + 16);
+    if (tx.size() < headersEnd + 4 + contentLength) return size;
+    hostRequests.push_back(tx.substr(0, headersEnd + 4 + contentLength));
+    tx.erase(0, headersEnd + 4 + contentLength);
+    rxFrom = rx.size();
+    rxSent = millis();
+    if (hostStale) {
+        hostStale = false;
+        open = false;
+    } else if (hostResponder) {
+        rx += hostResponder(hostRequests.back());
+    } else if (!hostResponses.empty()) {
+        rx += hostResponses.front();
+        hostResponses.pop_front();
+    }
+    return size;
+}
+
+size_t WiFiClient::arrived() {
+    if (!hostBytesPerSecond) return rx.size();
+    unsigned long elapsed = millis() - rxSent;
+    if (elapsed < hostFirstByteMs) return rxFrom;
+    return std::min(rx.size(), rxFrom + (size_t)((elapsed - hostFirstByteMs) * (unsigned long long)hostBytesPerSecond / 1000));
+}
+
+// Waits for the rest of the line, as Stream's does
+String WiFiClient::readStringUntil(char terminator) {
+    size_t start = pos;
+    while (pos < rx.size() && rx[pos] != terminator) {
+        if (pos < arrived()) pos++;
+        else delay(1);
+    }
+    std::string s = rx.substr(start, pos - start);
+    if (pos < rx.size()) pos++;
+    hostBytesRead += pos - start;
+    return String(s);
+}
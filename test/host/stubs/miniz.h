@@ -0,0 +1,82 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the tinfl calls of the ESP32 ROM copy of miniz, done by zlib when the build has it.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef HOST_ZLIB
+#include <zlib.h>
+#endif
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+// Padded to roughly the size of the real one, so heap use looks the same
+typedef struct tinfl_decompressor_tag {
+    int m_state;
+#ifdef HOST_ZLIB
+    z_stream z;
+#endif
+    char pad[11000];
+} tinfl_decompressor;
+
+#define tinfl_init(r) do { (r)->m_state = 0; } while (0)
+
+// Without zlib every stream fails, and the tests that need one are skipped
+static inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *inSize, uint8_t *outStart, uint8_t *outNext, size_t *outSize, uint32_t flags) {
+#ifdef HOST_ZLIB
+    if (r->m_state == 0) {
+        memset(&r->z, 0, sizeof(r->z));
+        inflateInit2(&r->z, (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15);
+        r->m_state = 1;
+    }
+    if (r->m_state == 2) {
+        *inSize = 0;
+        *outSize = 0;
+        return TINFL_STATUS_DONE;
+    }
+    r->z.next_in = (Bytef *)in;
+    r->z.avail_in = *inSize;
+    r->z.next_out = outNext;
+    r->z.avail_out = *outSize;
+    int rc = inflate(&r->z, Z_NO_FLUSH);
+    *inSize -= r->z.avail_in;
+    *outSize -= r->z.avail_out;
+    if (rc == Z_STREAM_END) {
+        inflateEnd(&r->z);
+        r->m_state = 2;
+        return TINFL_STATUS_DONE;
+    }
+    if (rc != Z_OK && rc != Z_BUF_ERROR) return TINFL_STATUS_FAILED;
+    if (r->z.avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+    return TINFL_STATUS_NEEDS_MORE_INPUT;
+#else
+    *inSize = 0;
+    *outSize = 0;
+    return TINFL_STATUS_FAILED;
+#endif
+}
@@ -0,0 +1,150 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - httpChunkDecoder, with chunk boundaries falling in every position, including inside the tags of a
+ * Darwin response read by raildataXmlClient.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <httpChunkDecoder.h>
+#include <raildataXmlClient.h>
+#include <LittleFS.h>
+
+// Chunked encoding of body, in chunks of the given size, optionally with extensions on the size lines, trailer
+// fields, upper case hex and bare LF line endings
+static std::string chunked(const std::string &body, size_t chunkSize, bool extensions = false, bool trailers = false, bool upperCase = false, const char *eol = "\r\n") {
+    std::string out;
+    char line[32];
+    for (size_t pos = 0; pos < body.size(); pos += chunkSize) {
+        size_t length = std::min(chunkSize, body.size() - pos);
+        snprintf(line, sizeof(line), upperCase ? "%zX" : "%zx", length);
+        out += line;
+        if (extensions) out += ";name=\"value\"";
+        out += eol + body.substr(pos, length) + eol;
+    }
+    out += extensions ? "0;last" : "0";
+    out += eol;
+    if (trailers) out += std::string("Expires: never") + eol + "X-Checksum: abc" + eol;
+    out += eol;
+    return out;
+}
+
+// Decodes with the block filter, the input split into two blocks at split
+static std::string decodeSplit(const std::string &encoded, size_t split, httpChunkDecoder &decoder) {
+    std::string buf = encoded;
+    decoder.reset(true);
+    size_t first = decoder.filter(&buf[0], split);
+    size_t second = decoder.filter(&buf[split], buf.size() - split);
+    return buf.substr(0, first) + buf.substr(split, second);
+}
+
+// Decodes a character at a time
+static std::string decodeChars(const std::string &encoded, httpChunkDecoder &decoder) {
+    std::string out;
+    decoder.reset(true);
+    for (char c : encoded) if (decoder.filter(c)) out += c;
+    return out;
+}
+
+static void testFraming() {
+    httpChunkDecoder decoder;
+    const std::string body = "<lt4:std>17:43</lt4:std><lt4:etd>On time</lt4:etd>";
+
+    for (size_t chunkSize : { (size_t)1, (size_t)3, (size_t)8, (size_t)17, body.size() }) {
+        for (int options = 0; options < 16; options++) {
+            bool extensions = options & 1, trailers = options & 2, upperCase = options & 4;
+            const char *eol = (options & 8) ? "\n" : "\r\n";
+            std::string encoded = chunked(body, chunkSize, extensions, trailers, upperCase, eol);
+            for (size_t split = 0; split <= encoded.size(); split++) {
+                std::string decoded = decodeSplit(encoded, split, decoder);
+                CHECK(decoded == body, "chunk %zu options %d split %zu gave \"%s\"", chunkSize, options, split, decoded.c_str());
+                CHECK(decoder.isComplete() && !decoder.isError(), "chunk %zu options %d split %zu not complete", chunkSize, options, split);
+            }
+            CHECK(decodeChars(encoded, decoder) == body && decoder.isComplete(), "chunk %zu options %d by character", chunkSize, options);
+        }
+    }
+
+    // Anything after the end of the body isn't passed through
+    std::string encoded = chunked(body, 10) + "HTTP/1.1 200 OK\r\n";
+    CHECK(decodeSplit(encoded, 5, decoder) == body && decoder.isComplete(), "data after the body");
+
+    // Not chunked, everything passes through
+    std::string plain = body;
+    decoder.reset(false);
+    CHECK(decoder.filter(&plain[0], plain.size()) == body.size() && plain == body, "not chunked");
+    CHECK(!decoder.isComplete() && !decoder.isError(), "not chunked state");
+
+    // Cut short, at every position
+    encoded = chunked(body, 8, true, true);
+    for (size_t length = 0; length < encoded.size(); length++) {
+        decodeSplit(encoded.substr(0, length), length / 2, decoder);
+        CHECK(!decoder.isComplete() && !decoder.isError(), "truncated at %zu", length);
+    }
+
+    // Invalid framing
+    const char *invalid[] = {
+        "x\r\nabc\r\n0\r\n\r\n",            // Not a size
+        "\r\nabc\r\n0\r\n\r\n",             // No size
+        "3\r\nabcd\r\n0\r\n\r\n",           // Data longer than its size
+        "3\r\nabc\r0\r\n\r\n",              // CR without LF after the data
+        "3\rabc\r\n0\r\n\r\n",              // CR without LF after the size
+        "10000000\r\n",                     // Far too big
+        "0\r\n\rx",                         // Bad end of trailers
+    };
+    for (const char *text : invalid) {
+        std::string buf = text;
+        decoder.reset(true);
+        decoder.filter(&buf[0], buf.size());
+        CHECK(decoder.isError() && !decoder.isComplete(), "invalid framing \"%s\" not caught", text);
+    }
+}
+
+static void progress(int state, int id) {}
+
+// The board read from a chunked response matches the one read from a plain one, wherever the boundaries fall
+static void testClient() {
+    static rdStation station;
+    static stnMessages messages;
+    static rdStation plainStation;
+    static stnMessages plainMessages;
+    std::string details = readDataFile("darwin_details.xml");
+
+    LittleFS.remove(WSDLCACHEFILE);
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    raildataXmlClient *client = new raildataXmlClient();
+    CHECK(client->init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) == UPD_SUCCESS, "init");
+    hostResponses.push_back(hostHttpResponse(details));
+    CHECK(client->updateDepartures(&plainStation, &plainMessages, "CLJ", "token", MAXBOARDSERVICES, true, "") == UPD_SUCCESS, "plain update");
+    delete client;
+
+    for (size_t chunkSize : { 1, 2, 5, 11, 64, 509, 4093, 100000 }) {
+        for (int trailers = 0; trailers < 2; trailers++) {
+            // A new client each time, so every update is a first one and copies the whole board
+            LittleFS.remove(WSDLCACHEFILE);
+            hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+            client = new raildataXmlClient();
+            client->init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress);
+            memset(&station, 0, sizeof(station));
+            memset(&messages, 0, sizeof(messages));
+            hostResponses.push_back("HTTP/1.1 200 OK\r\nContent-Type: text/xml\r\nTransfer-Encoding: chunked\r\n\r\n" + chunked(details, chunkSize, true, trailers));
+            delay(60000);
+            int result = client->updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+            CHECK(result == UPD_SUCCESS, "chunk %zu update %d %s", chunkSize, result, client->getLastError().c_str());
+            CHECK(memcmp(&station, &plainStation, sizeof(station)) == 0, "chunk %zu board differs", chunkSize);
+            CHECK(memcmp(&messages, &plainMessages, sizeof(messages)) == 0, "chunk %zu messages differ", chunkSize);
+            delete client;
+        }
+    }
+}
+
+int main() {
+    testFraming();
+    testClient();
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
@@ -0,0 +1,111 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - when raildataXmlClient asks for the board alone and when it needs the calling points as well.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <LittleFS.h>
+
+static rdStation station;
+static stnMessages messages;
+static std::string details;
+static std::string board;
+static int boardRequests;
+static int detailRequests;
+
+static void progress(int state, int id) {}
+
+// Removes every serviceID with the given value
+static std::string withoutServiceID(const std::string &text, const std::string &serviceID) {
+    std::string result = text;
+    std::string element = "<lt4:serviceID>" + serviceID + "</lt4:serviceID>";
+    size_t p;
+    while ((p = result.find(element)) != std::string::npos) result.erase(p, element.size());
+    return result;
+}
+
+// Answers each request with the board or details response, counting which was asked for
+static int update(raildataXmlClient &client, unsigned long wait = 60000, bool arrivals = false) {
+    boardRequests = 0;
+    detailRequests = 0;
+    hostResponder = [](const std::string &request) {
+        bool withDetails = request.find("WithDetails") != std::string::npos;
+        (withDetails ? detailRequests : boardRequests)++;
+        return hostHttpResponse(withDetails ? details : board);
+    };
+    delay(wait);
+    int result = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "", arrivals);
+    hostResponder = nullptr;
+    return result;
+}
+
+int main() {
+    std::string firstID = "1048573CLPHMJN_";
+    details = readDataFile("darwin_details.xml");
+    board = readDataFile("darwin_board.xml");
+
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient client;
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    CHECK(client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) == UPD_SUCCESS, "init");
+
+    // The first update asks for the details, later ones the board alone
+    CHECK(update(client) == UPD_SUCCESS && detailRequests == 1 && boardRequests == 0, "first update: %d details, %d board", detailRequests, boardRequests);
+    std::string calling = station.calling;
+    CHECK(calling.size() > 0, "no calling points");
+    CHECK(update(client) == UPD_NO_CHANGE && detailRequests == 0 && boardRequests == 1, "second update: %d details, %d board", detailRequests, boardRequests);
+    CHECK(calling == station.calling, "calling points lost");
+
+    // When the first service leaves, the next is already cached
+    size_t firstService = board.find("<lt8:service>");
+    std::string fullBoard = board;
+    board.erase(firstService, board.find("</lt8:service>") + strlen("</lt8:service>") - firstService);
+    CHECK(update(client) == UPD_SUCCESS && detailRequests == 0 && boardRequests == 1, "first service gone: %d details, %d board", detailRequests, boardRequests);
+    CHECK(strlen(station.calling) > 0, "second service's calling points not cached");
+
+    // A first service that isn't cached needs the details
+    board = fullBoard;
+    board.replace(board.find(firstID), firstID.size(), "9999999CLPHMJN_");
+    details.replace(details.find(firstID), firstID.size(), "9999999CLPHMJN_");
+    CHECK(update(client) == UPD_SUCCESS && detailRequests == 1 && boardRequests == 1, "new first service: %d details, %d board", detailRequests, boardRequests);
+
+    // A first service without a serviceID (a bus or replacement row, say) can't be looked up, so it mustn't
+    // cause a details request on every poll
+    details = withoutServiceID(details, "9999999CLPHMJN_");
+    board = withoutServiceID(board, "9999999CLPHMJN_");
+    update(client);
+    for (int poll = 0; poll < 3; poll++) {
+        int result = update(client);
+        CHECK((result == UPD_SUCCESS || result == UPD_NO_CHANGE) && detailRequests == 0 && boardRequests == 1, "no serviceID, poll %d: %d details, %d board", poll, detailRequests, boardRequests);
+    }
+    // ...but the details are still refreshed every DETAILREFRESHINTERVAL
+    update(client, DETAILREFRESHINTERVAL);
+    CHECK(detailRequests == 1 && boardRequests == 0, "no serviceID, refresh: %d details, %d board", detailRequests, boardRequests);
+
+    // An arrivals and departures board makes one request a poll. A first service that isn't cached goes without its
+    // calling points until the next poll, which asks for the details.
+    details = readDataFile("darwin_details.xml");
+    board = fullBoard;
+    update(client, 60000, true);
+    CHECK(detailRequests == 1 && boardRequests == 0, "arrivals, first update: %d details, %d board", detailRequests, boardRequests);
+    update(client, 60000, true);
+    CHECK(detailRequests == 0 && boardRequests == 1, "arrivals, second update: %d details, %d board", detailRequests, boardRequests);
+    board.replace(board.find(firstID), firstID.size(), "8888888CLPHMJN_");
+    details.replace(details.find(firstID), firstID.size(), "8888888CLPHMJN_");
+    int result = update(client, 60000, true);
+    CHECK(result == UPD_SUCCESS && detailRequests == 0 && boardRequests == 1, "arrivals, new first service: %d details, %d board", detailRequests, boardRequests);
+    CHECK(!station.calling[0], "arrivals, new first service has calling points \"%s\"", station.calling);
+    result = update(client, 60000, true);
+    CHECK(result == UPD_SUCCESS && detailRequests == 1 && boardRequests == 0, "arrivals, next poll: %d details, %d board", detailRequests, boardRequests);
+    CHECK(station.calling[0], "arrivals, next poll has no calling points");
+
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
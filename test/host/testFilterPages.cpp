@@ -0,0 +1,100 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - a board filtered on a calling point is filled from successive time windows, and shows what it has
+ * when the request budget runs out part way.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <requestBudget.h>
+#include <LittleFS.h>
+
+static rdStation station;
+static stnMessages messages;
+static std::string details;
+static std::string board;
+static int pageServices[FILTERPAGES][2];    // The services (first, last + 1) in each time window's response
+static std::vector<std::string> requests;
+
+static void progress(int state, int id) {}
+
+// The response with only services first to last - 1 left in it
+static std::string keepServices(const std::string &text, int first, int last) {
+    std::string result;
+    size_t pos = 0;
+    int n = 0;
+    for (;;) {
+        size_t start = text.find("<lt8:service>", pos);
+        if (start == std::string::npos) break;
+        size_t end = text.find("</lt8:service>", start) + strlen("</lt8:service>");
+        result += text.substr(pos, start - pos);
+        if (n >= first && n < last) result += text.substr(start, end - start);
+        pos = end;
+        n++;
+    }
+    return result + text.substr(pos);
+}
+
+static int update(raildataXmlClient &client, unsigned long wait = 60000) {
+    requests.clear();
+    hostResponder = [](const std::string &request) {
+        requests.push_back(request.substr(request.find("\r\n\r\n") + 4));
+        int page = request.find("<ns0:timeOffset>") != std::string::npos ? 1 : 0;
+        const std::string &body = request.find("WithDetails") != std::string::npos ? details : board;
+        return hostHttpResponse(keepServices(body, pageServices[page][0], pageServices[page][1]));
+    };
+    delay(wait);
+    int result = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "WAT");
+    hostResponder = nullptr;
+    return result;
+}
+
+int main() {
+    details = readDataFile("darwin_details.xml");
+    board = readDataFile("darwin_board.xml");
+
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient client;
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    CHECK(client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) == UPD_SUCCESS, "init");
+
+    // A full first window needs no more
+    pageServices[0][0] = 0; pageServices[0][1] = MAXBOARDSERVICES;
+    pageServices[1][0] = 0; pageServices[1][1] = 0;
+    CHECK(update(client) == UPD_SUCCESS, "full window");
+    CHECK(requests.size() == 1, "full window made %zu requests", requests.size());
+    CHECK(requests[0].find("<ns0:filterCrs>WAT</ns0:filterCrs><ns0:filterType>to</ns0:filterType>") != std::string::npos, "no filter in request");
+    CHECK(station.numServices == MAXBOARDSERVICES, "full window has %d services", station.numServices);
+
+    // A short first window is filled from the next
+    pageServices[0][0] = 0; pageServices[0][1] = 3;
+    pageServices[1][0] = 3; pageServices[1][1] = 6;
+    CHECK(update(client) == UPD_SUCCESS, "two windows");
+    CHECK(requests.size() == 2, "two windows made %zu requests", requests.size());
+    CHECK(requests.size() == 2 && requests[1].find("<ns0:timeOffset>" + std::to_string(FILTERMAXOFFSET < FILTERTIMEWINDOW ? FILTERMAXOFFSET : FILTERTIMEWINDOW) + "</ns0:timeOffset>") != std::string::npos, "second window's offset");
+    CHECK(station.numServices == 6, "two windows have %d services", station.numServices);
+
+    // When the budget only allows the first window, its services are shown
+    pageServices[0][0] = 0; pageServices[0][1] = 4;
+    apiBudget.setLimit(UPSTREAM_DARWIN, DARWINPERHOUR, 1);
+    int result = update(client);
+    CHECK(result == UPD_SUCCESS, "budget for one window: result %d %s", result, client.getLastError().c_str());
+    CHECK(requests.size() == 1, "budget for one window made %zu requests", requests.size());
+    CHECK(station.numServices == 4, "budget for one window has %d services", station.numServices);
+
+    // With no budget at all, nothing is requested and the board is left alone
+    apiBudget.setLimit(UPSTREAM_DARWIN, DARWINPERHOUR, 1);
+    update(client, 0);
+    result = update(client, 0);
+    CHECK(result == UPD_THROTTLED && requests.empty(), "no budget: result %d, %zu requests", result, requests.size());
+    CHECK(station.numServices == 4, "no budget changed the board to %d services", station.numServices);
+
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
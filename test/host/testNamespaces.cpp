@@ -0,0 +1,115 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the namespace ids xmlStreamingParser reports, including for elements that declare their own prefix
+ * or default namespace.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <xmlStreamingParser.h>
+#include <raildataXmlClient.h>
+#include <vector>
+
+static const char * const tagNames[DARWIN_TAG_COUNT] = { DARWIN_TAGS(DARWIN_TAG_NAME) };
+static const char * const namespaceURIs[DARWIN_NS_COUNT] = { DARWIN_NAMESPACES(DARWIN_TAG_NAME) };
+
+struct startEvent {
+    std::string name;
+    uint8_t ns;
+    uint8_t id;
+    int attributes;     // Attributes reported before the start tag
+};
+
+// Records each start tag with the ids it was reported with
+class recordingListener : public xmlListener {
+    public:
+        std::vector<startEvent> starts;
+        int attributes = 0;
+        int ends = 0;
+
+        int startTag(const char *tagName, const xmlTagStack &tags) {
+            starts.push_back({ tagName, tags.currentNs(), tags.current(), attributes });
+            attributes = 0;
+            return XML_CONTINUE;
+        }
+        int endTag(const char *tagName, const xmlTagStack &tags) { ends++; return XML_CONTINUE; }
+        void parameter(const char *param) {}
+        void valueChunk(const char *value, size_t length, bool last, const xmlTagStack &tags) {}
+        void attribute(const char *name, const char *value, const xmlTagStack &tags) { attributes++; }
+};
+
+static recordingListener parseDocument(const std::string &doc, bool bulk) {
+    recordingListener listener;
+    xmlStreamingParser parser;
+    parser.setListener(&listener);
+    parser.setTagTable(tagNames, DARWIN_TAG_COUNT);
+    parser.setNamespaceTable(namespaceURIs, DARWIN_NS_COUNT);
+    parser.reset();
+    if (bulk) parser.parse(doc.data(), doc.size());
+    else for (char c : doc) parser.parse(c);
+    return listener;
+}
+
+static const startEvent *findStart(const recordingListener &listener, const char *name) {
+    for (const startEvent &e : listener.starts) if (e.name == name) return &e;
+    return nullptr;
+}
+
+static void replaceAll(std::string &doc, const std::string &from, const std::string &to) {
+    for (size_t p = doc.find(from); p != std::string::npos; p = doc.find(from, p + to.size())) doc.replace(p, from.size(), to);
+}
+
+// A board where every element other than the SOAP envelope is Darwin's, so should be reported as NS_DARWIN
+static void checkBoard(const char *label, const std::string &doc) {
+    for (int bulk = 0; bulk < 2; bulk++) {
+        recordingListener listener = parseDocument(doc, bulk);
+        int elements = 0;
+        for (size_t p = doc.find('<'); p != std::string::npos; p = doc.find('<', p + 1)) if (isalpha((uint8_t)doc[p + 1])) elements++;
+        CHECK((int)listener.starts.size() == elements, "%s: %zu start tags, expected %d", label, listener.starts.size(), elements);
+        CHECK(listener.ends == elements, "%s: %d end tags, expected %d", label, listener.ends, elements);
+        for (const startEvent &e : listener.starts) {
+            bool soap = e.name.compare(0, 5, "soap:") == 0;
+            CHECK(e.ns == (soap ? NS_SOAP_ENVELOPE : NS_DARWIN), "%s: <%s> reported in namespace %d", label, e.name.c_str(), e.ns);
+        }
+    }
+}
+
+int main() {
+    // The root element declares its own prefix, and the response element its own default namespace
+    std::string board = readDataFile("darwin_board.xml");
+    board.erase(0, board.find("<soap:Envelope"));   // Without the XML declaration, which isn't an element
+    checkBoard("board", board);
+    recordingListener listener = parseDocument(board, true);
+    CHECK(!listener.starts.empty() && listener.starts[0].name == "soap:Envelope" && listener.starts[0].attributes == 3, "root not reported after its attributes");
+
+    // Elements that declare a versioned prefix for themselves, including an empty one
+    std::string versioned = board;
+    const std::string lt9 = " xmlns:lt9=\"http://thalesgroup.com/RTTI/2099-01-01/ldb/types\"";
+    replaceAll(versioned, "<lt4:nrccMessages>", "<lt9:nrccMessages" + lt9 + ">");
+    replaceAll(versioned, "</lt4:nrccMessages>", "</lt9:nrccMessages>");
+    replaceAll(versioned, "<lt4:crs>CLJ</lt4:crs>", "<lt4:crs>CLJ</lt4:crs><lt9:via" + lt9 + " />");
+    checkBoard("versioned", versioned);
+    listener = parseDocument(versioned, false);
+    const startEvent *messages = findStart(listener, "lt9:nrccMessages");
+    CHECK(messages && messages->ns == NS_DARWIN && messages->id == TAG_NRCCMESSAGES, "lt9:nrccMessages not resolved");
+    const startEvent *via = findStart(listener, "lt9:via");
+    CHECK(via && via->ns == NS_DARWIN && via->id == TAG_VIA, "empty lt9:via not resolved");
+
+    // A declaration on an element only lasts until it closes
+    listener = parseDocument("<a:message xmlns:a=\"urn:other\"><b:via xmlns:b=\"http://thalesgroup.com/RTTI/2099-01-01/ldb/\"/></a:message>"
+        "<b:message xmlns:x=\"urn:x\"></b:message>", true);
+    CHECK(listener.starts.size() == 3, "%zu start tags", listener.starts.size());
+    if (listener.starts.size() == 3) {
+        CHECK(listener.starts[0].ns == XML_NS_UNKNOWN, "a:message in namespace %d", listener.starts[0].ns);
+        CHECK(listener.starts[1].ns == NS_DARWIN && listener.starts[1].id == TAG_VIA, "b:via in namespace %d", listener.starts[1].ns);
+        CHECK(listener.starts[2].ns == XML_NS_UNKNOWN, "b:message still in namespace %d after b:via closed", listener.starts[2].ns);
+    }
+
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
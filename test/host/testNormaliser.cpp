@@ -0,0 +1,91 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - textNormaliser against the golden output of the functions it replaced (written by benchNormaliser
+ * --golden), and its phrase matching against strstr.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <normaliserCorpus.h>
+#include <random>
+
+//
+// The old output with the intended changes made to it. Messages have runs of spaces collapsed and any leading
+// spaces dropped, and one left with nothing but fullstops and spaces is empty rather than a lone fullstop.
+//
+static std::string intended(const std::string &golden, int mode) {
+    if (mode != MODE_MESSAGE && mode != MODE_STATION) return golden;
+    if (golden == ".") return "";
+    std::string out;
+    for (char c : golden) {
+        if (c == ' ' && (out.empty() || out.back() == ' ')) continue;
+        out += c;
+    }
+    return out;
+}
+
+static void testGolden() {
+    std::vector<std::string> corpus = readCorpus();
+    std::istringstream golden(readDataFile("normaliser_golden.txt"));
+    static char buf[MAXMESSAGESIZE * 4];
+    int compared = 0;
+
+    for (const std::string &item : corpus) {
+        for (int mode = 0; mode < MODE_COUNT; mode++) {
+            std::string line;
+            if (!std::getline(golden, line)) {
+                CHECK(false, "golden output ends before \"%s\"", escapeText(item).c_str());
+                return;
+            }
+            size_t space = line.find(' ');
+            CHECK(line.substr(0, space) == modeNames[mode], "golden line \"%s\" isn't for %s", line.c_str(), modeNames[mode]);
+            std::string expected = intended(line.substr(space + 1), mode);
+            strcpy(buf, item.c_str());
+            normaliseText(buf, mode);
+            std::string actual = escapeText(buf);
+            CHECK(actual == expected, "%s \"%s\"\n  gave     \"%s\"\n  expected \"%s\"", modeNames[mode], escapeText(item).c_str(), actual.c_str(), expected.c_str());
+            compared++;
+        }
+    }
+    std::string extra;
+    CHECK(!std::getline(golden, extra), "golden output has more lines than the corpus");
+    printf("%d golden outputs compared\n", compared);
+}
+
+// Random text cut short at a phrase that partly matches itself, which is where the fallback tables matter
+static void testPhrases() {
+    const char *phrases[] = { "aab", "abab", "aaaa", "abaab", "a a b" };
+    std::mt19937 random(1);
+    char text[64];
+    for (const char *phrase : phrases) {
+        textNormaliser normaliser(TEXT_PRINTABLE, &phrase, 1);
+        for (int n = 0; n < 20000; n++) {
+            int length = random() % (sizeof(text) - 1);
+            for (int i = 0; i < length; i++) text[i] = "ab "[random() % 3];
+            text[length] = '\0';
+            std::string expected = text;
+            size_t pos = expected.find(phrase);
+            if (pos != std::string::npos) expected.resize(pos);
+            size_t result = normaliser.normalise(text);
+            CHECK(expected == text && result == expected.size(), "\"%s\" gave \"%s\", expected \"%s\"", phrase, text, expected.c_str());
+        }
+    }
+
+    // Phrases too long to match are left out
+    const char *tooLong[] = { "this phrase is far too long to be matched", " stop" };
+    textNormaliser normaliser(TEXT_PRINTABLE, tooLong, 2);
+    char message[] = "this phrase is far too long to be matched, stop here";
+    normaliser.normalise(message);
+    CHECK(strcmp(message, "this phrase is far too long to be matched,") == 0, "too long phrase gave \"%s\"", message);
+}
+
+int main() {
+    testGolden();
+    testPhrases();
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
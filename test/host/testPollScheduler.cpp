@@ -0,0 +1,171 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - pollScheduler's intervals, one poll at a time and over a simulated day of National Rail and TfL
+ * boards.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <pollScheduler.h>
+#include <vector>
+
+// As the sketch sets them up
+#define NRBASE 150000UL
+#define NRMIN 60000UL
+#define NRMAX 300000UL
+#define TUBEBASE 30000UL
+#define TUBEMIN 20000UL
+#define TUBEMAX 90000UL
+
+static void testIntervals() {
+    pollScheduler polls(NRBASE, NRMIN, NRMAX);
+
+    // Unchanged boards stretch the interval to twice the base, a change puts it back
+    unsigned long expected[] = { NRBASE, NRBASE, NRBASE, 187500, 225000, 262500, 300000, 300000 };
+    CHECK(polls.nextInterval(true, 10, false, 12) == expected[0], "changed");
+    for (int i = 1; i < 8; i++) {
+        unsigned long interval = polls.nextInterval(false, 10, false, 12);
+        CHECK(interval == expected[i], "unchanged %d: %lu, expected %lu", i, interval, expected[i]);
+    }
+    CHECK(polls.getUnchanged() == POLLSTREAKMAX, "streak %d", polls.getUnchanged());
+    CHECK(polls.nextInterval(true, 10, false, 12) == NRBASE && polls.getUnchanged() == 0, "change after a streak");
+
+    // Nothing for a while, twice as long, but disruption keeps it to the base
+    CHECK(polls.nextInterval(true, -1, false, 12) == NRMAX, "empty board");
+    CHECK(polls.nextInterval(true, POLLDISTANTMINS, false, 12) == NRMAX, "distant first service");
+    CHECK(polls.nextInterval(true, POLLDISTANTMINS - 1, false, 12) == NRBASE, "first service not distant");
+    CHECK(polls.nextInterval(true, -1, true, 12) == NRBASE, "empty board with disruption");
+
+    // The quiet hours are polled at the longest interval
+    for (int hour = -1; hour < 24; hour++) {
+        unsigned long interval = polls.nextInterval(true, 10, false, hour);
+        bool quiet = hour >= POLLQUIETSTARTS && hour < POLLQUIETENDS;
+        CHECK(interval == (quiet ? NRMAX : NRBASE), "hour %d: %lu", hour, interval);
+    }
+
+    // About to go: faster while it's changing, no slower than the base while it isn't
+    polls.reset();
+    CHECK(polls.nextInterval(true, POLLSOONMINS, false, 12) == NRBASE * 2 / 3, "due and changing");
+    for (int i = 0; i < POLLSTREAKMAX; i++) polls.nextInterval(false, 10, false, 12);
+    CHECK(polls.nextInterval(false, 0, false, 12) == NRBASE, "due and unchanged");
+
+    // TfL's arrival times change on every poll, so it doesn't hurry
+    pollScheduler tube(TUBEBASE, TUBEMIN, TUBEMAX, false);
+    CHECK(tube.nextInterval(true, 2, false, 12) == TUBEBASE, "tube due: %lu", tube.nextInterval(true, 2, false, 12));
+
+    // The limits always win, and a maximum below the minimum is raised to it
+    polls.setLimits(200000, 250000);
+    CHECK(polls.nextInterval(true, 2, false, 12) == 200000, "raised to the minimum");
+    CHECK(polls.nextInterval(true, -1, false, 12) == 250000, "cut to the maximum");
+    polls.setLimits(200000, 100000);
+    CHECK(polls.nextInterval(true, -1, false, 12) == 200000, "maximum below minimum");
+}
+
+static void testMinutesUntil() {
+    struct { const char *time; int hour, minute, expected; } cases[] = {
+        { "12:05", 12, 0, 5 },
+        { "12:00", 12, 0, 0 },
+        { "12:00", 12, 30, 0 },     // Already gone
+        { "00:05", 23, 58, 7 },     // Over midnight
+        { "23:58", 0, 3, 0 },       // Gone, the day before
+        { "11:59", 0, 0, 719 },
+        { "12:01", 0, 0, 0 },       // More than 12 hours ahead is taken as yesterday
+        { "On time", 12, 0, -1 },
+        { "1:05", 12, 0, -1 },
+        { "", 12, 0, -1 },
+    };
+    for (auto &c : cases) {
+        int minutes = pollScheduler::minutesUntil(c.time, c.hour, c.minute);
+        CHECK(minutes == c.expected, "\"%s\" at %02d:%02d gave %d, expected %d", c.time, c.hour, c.minute, minutes, c.expected);
+    }
+}
+
+//
+// A day of polls against a simulated clock, starting at midnight. Trains leave every 15 minutes from 05:30 to
+// 00:30, and the board changes when its first train goes, or while it's due and its estimate is being updated.
+// Returns the polls made in each hour.
+//
+static std::vector<int> simulateNR(unsigned long *shortest, unsigned long *longest) {
+    pollScheduler polls(NRBASE, NRMIN, NRMAX);
+    std::vector<int> perHour(24, 0);
+    *shortest = ~0UL;
+    *longest = 0;
+    int lastFirst = -1;
+    for (unsigned long now = 0; now < 24 * 3600000UL; ) {
+        int minuteOfDay = now / 60000;
+        int first = 0;          // Minute of the day the first train goes
+        int minutesToFirst = 1440;
+        for (int t = 5 * 60 + 30; t <= 24 * 60 + 30; t += 15) {
+            int until = (t - minuteOfDay + 1440) % 1440;
+            if (until < minutesToFirst) {
+                minutesToFirst = until;
+                first = t % 1440;
+            }
+        }
+        bool changed = first != lastFirst || (minutesToFirst >= 0 && minutesToFirst <= 2);
+        lastFirst = first;
+
+        unsigned long interval = polls.nextInterval(changed, minutesToFirst, false, now / 3600000UL);
+        if (interval < *shortest) *shortest = interval;
+        if (interval > *longest) *longest = interval;
+        perHour[now / 3600000UL]++;
+        now += interval;
+    }
+    return perHour;
+}
+
+// A day of TfL polls. Something's always due within a few minutes and the times change on every poll.
+static std::vector<int> simulateTfL(unsigned long *shortest, unsigned long *longest) {
+    pollScheduler polls(TUBEBASE, TUBEMIN, TUBEMAX, false);
+    std::vector<int> perHour(24, 0);
+    *shortest = ~0UL;
+    *longest = 0;
+    for (unsigned long now = 0; now < 24 * 3600000UL; ) {
+        int hour = now / 3600000UL;
+        bool quiet = hour >= POLLQUIETSTARTS && hour < POLLQUIETENDS;
+        unsigned long interval = polls.nextInterval(true, quiet ? -1 : 3, false, hour);
+        if (interval < *shortest) *shortest = interval;
+        if (interval > *longest) *longest = interval;
+        perHour[hour]++;
+        now += interval;
+    }
+    return perHour;
+}
+
+static void testSimulatedDay() {
+    unsigned long shortest, longest;
+    std::vector<int> nr = simulateNR(&shortest, &longest);
+    int total = 0;
+    for (int hour = 0; hour < 24; hour++) {
+        total += nr[hour];
+        bool quiet = hour >= POLLQUIETSTARTS && hour < POLLQUIETENDS;
+        if (quiet) CHECK(nr[hour] <= (int)(3600000UL / NRMAX) + 1, "NR hour %d polled %d times", hour, nr[hour]);
+        else CHECK(nr[hour] >= (int)(3600000UL / NRMAX), "NR hour %d polled only %d times", hour, nr[hour]);
+        CHECK(nr[hour] <= (int)(3600000UL / NRMIN), "NR hour %d polled %d times", hour, nr[hour]);
+    }
+    CHECK(shortest >= NRMIN && longest <= NRMAX, "NR intervals %lu to %lu", shortest, longest);
+    CHECK(shortest < NRBASE, "NR never hurried for a departure");
+    CHECK(total < (int)(24 * 3600000UL / NRBASE), "NR made %d polls, the fixed interval makes %lu", total, 24 * 3600000UL / NRBASE);
+    printf("NR: %d polls in the day (%lu at the fixed interval), %lu to %lu ms apart\n", total, 24 * 3600000UL / NRBASE, shortest, longest);
+
+    std::vector<int> tube = simulateTfL(&shortest, &longest);
+    total = 0;
+    for (int count : tube) total += count;
+    CHECK(shortest >= TUBEBASE, "TfL polled every %lu ms, more often than the fixed interval", shortest);
+    CHECK(longest <= TUBEMAX, "TfL interval %lu", longest);
+    CHECK(tube[12] == (int)(3600000UL / TUBEBASE), "TfL polled %d times at midday", tube[12]);
+    printf("TfL: %d polls in the day (%lu at the fixed interval), %lu to %lu ms apart\n", total, 24 * 3600000UL / TUBEBASE, shortest, longest);
+}
+
+int main() {
+    testIntervals();
+    testMinutesUntil();
+    testSimulatedDay();
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
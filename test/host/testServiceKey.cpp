@@ -0,0 +1,129 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - the order of a board with bus services in it, which raildataXmlClient sorts on keys from the board's
+ * generatedAt time. Boards spanning midnight, the GMT/BST changes, and generatedAt in its different forms.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <LittleFS.h>
+
+static rdStation station;
+static stnMessages messages;
+static std::string boardStart;      // darwin_board.xml up to generatedAt's value
+static std::string boardMiddle;     // From the end of generatedAt to the start of the train services
+
+static void progress(int state, int id) {}
+
+// A service, its time given as the std or, if it starts with '*', as the sta of one that terminates here
+static std::string service(const std::string &time, int n, bool bus) {
+    bool terminates = time[0] == '*';
+    std::string s = "<lt8:service>";
+    if (terminates) s += "<lt4:sta>" + time.substr(1) + "</lt4:sta><lt4:eta>On time</lt4:eta>";
+    else s += "<lt4:std>" + time + "</lt4:std><lt4:etd>On time</lt4:etd>";
+    if (bus) s += "<lt4:serviceType>bus</lt4:serviceType>";
+    s += "<lt4:serviceID>" + std::to_string(1000000 + n) + "CLPHMJN_</lt4:serviceID>";
+    s += "<lt5:origin><lt4:location><lt4:locationName>Origin " + std::to_string(n) + "</lt4:locationName><lt4:crs>ORG</lt4:crs></lt4:location></lt5:origin>";
+    s += "<lt5:destination><lt4:location><lt4:locationName>" + std::string(terminates ? "Clapham Junction" : "Destination " + std::to_string(n)) + "</lt4:locationName><lt4:crs>DST</lt4:crs></lt4:location></lt5:destination>";
+    return s + "</lt8:service>";
+}
+
+// A board generated at the given time (or with no generatedAt if it's null), with the trains and buses in the
+// order Darwin gives them
+static std::string makeBoard(const char *generatedAt, std::vector<std::string> trains, std::vector<std::string> buses) {
+    std::string xml = boardStart;
+    if (generatedAt) xml += generatedAt;
+    xml += boardMiddle;
+    if (!generatedAt) {
+        size_t start = xml.find("<lt4:generatedAt>");
+        xml.erase(start, xml.find("</lt4:generatedAt>") + strlen("</lt4:generatedAt>") - start);
+    }
+    int n = 0;
+    xml += "<lt8:trainServices>";
+    for (const std::string &t : trains) xml += service(t, n++, false);
+    xml += "</lt8:trainServices><lt8:busServices>";
+    for (const std::string &t : buses) xml += service(t, n++, true);
+    return xml + "</lt8:busServices></GetStationBoardResult></GetDepartureBoardResponse></soap:Body></soap:Envelope>";
+}
+
+// The board's times, in the order they're shown
+static std::string boardTimes() {
+    std::string times;
+    for (int i = 0; i < station.numServices; i++) {
+        if (i) times += " ";
+        times += station.service[i].sTime[0] ? station.service[i].sTime : std::string("*") + station.service[i].sta;
+    }
+    return times;
+}
+
+static void checkOrder(const char *label, const char *generatedAt, std::vector<std::string> trains, std::vector<std::string> buses, const char *expected, bool arrivals = false) {
+    // A new client each time, so every board is keyed afresh and read in full
+    LittleFS.remove(WSDLCACHEFILE);
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    raildataXmlClient client;
+    client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress);
+    std::string board = makeBoard(generatedAt, trains, buses);
+    hostResponder = [&](const std::string &request) { return hostHttpResponse(board); };
+    delay(60000);   // Leave time for the request budget to refill
+    int result = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "", arrivals);
+    hostResponder = nullptr;
+    CHECK(result == UPD_SUCCESS, "%s: result %d %s", label, result, client.getLastError().c_str());
+    std::string times = boardTimes();
+    CHECK(times == expected, "%s: order \"%s\", expected \"%s\"", label, times.c_str(), expected);
+}
+
+int main() {
+    std::string board = readDataFile("darwin_board.xml");
+    size_t valueStart = board.find("<lt4:generatedAt>") + strlen("<lt4:generatedAt>");
+    boardStart = board.substr(0, valueStart);
+    boardMiddle = board.substr(board.find("</lt4:generatedAt>"), board.find("<lt8:trainServices>") - board.find("</lt4:generatedAt>"));
+
+    // An ordinary evening board, with generatedAt as Darwin sends it
+    checkOrder("evening", "2025-03-14T17:42:08.4529261+00:00", { "17:43", "17:50", "18:05" }, { "17:45", "18:00" },
+        "17:43 17:45 17:50 18:00 18:05");
+
+    // Spanning midnight, the times after it come last
+    checkOrder("midnight", "2025-03-14T23:50:12.0410000+00:00", { "23:52", "23:58", "00:05", "00:20" }, { "23:55", "00:10", "01:30" },
+        "23:52 23:55 23:58 00:05 00:10 00:20 01:30");
+
+    // Just after midnight, a late running service from before it still comes first
+    checkOrder("after midnight", "2025-03-15T00:03:40.5+00:00", { "23:58", "00:04", "00:30" }, { "00:15" },
+        "23:58 00:04 00:15 00:30");
+
+    // Far either side of generatedAt: over 6 hours earlier is the next day, over 18 hours later is the day before
+    checkOrder("limits", "2025-03-14T21:30:00+00:00", { "21:20", "15:29", "15:31" }, { "21:40" },
+        "15:31 21:20 21:40 15:29");
+
+    // Arrivals terminating here are keyed on their sta
+    checkOrder("arrivals", "2025-03-14T23:55:00+00:00", { "*23:57", "00:02", "*00:12" }, { "00:05" },
+        "*23:57 00:02 00:05 *00:12", true);
+
+    // GMT to BST on 30 March 2025, when the clocks go from 01:00 to 02:00. Times are wall clock, so those after the
+    // change follow on without a gap.
+    checkOrder("spring forward, before", "2025-03-30T00:52:31.1234567+00:00", { "00:55", "02:05", "02:20" }, { "00:58", "02:10" },
+        "00:55 00:58 02:05 02:10 02:20");
+    checkOrder("spring forward, after", "2025-03-30T02:01:30.25+01:00", { "00:59", "02:05" }, { "02:03" },
+        "00:59 02:03 02:05");
+
+    // BST to GMT on 26 October 2025, when the clocks go back from 02:00 to 01:00. Either side of the change, the
+    // times that follow it are in order. (Times in the repeated hour are ambiguous, and are taken as they read.)
+    checkOrder("fall back, before", "2025-10-26T00:40:00.0000001+01:00", { "00:45", "02:10", "02:30" }, { "00:50", "02:15" },
+        "00:45 00:50 02:10 02:15 02:30");
+    checkOrder("fall back, after", "2025-10-26T01:10:00+00:00", { "01:15", "01:40", "02:05" }, { "01:30" },
+        "01:15 01:30 01:40 02:05");
+
+    // Without a fraction, or with no generatedAt at all, when the first service's time is used
+    checkOrder("no fraction", "2025-06-01T23:59:59+01:00", { "23:59", "00:10" }, { "00:01" },
+        "23:59 00:01 00:10");
+    checkOrder("no generatedAt", nullptr, { "23:45", "00:10" }, { "23:50", "00:20" },
+        "23:45 23:50 00:10 00:20");
+
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}
@@ -0,0 +1,117 @@
+/*
+ * Departures Board (c) 2025 Gadec Software
+ *
+ * Host Tests - truncated and malformed Darwin responses are rejected, and leave the last good board as it was. Board
+ * text that overflows the client's text arena is reported.
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <hostTest.h>
+#include <raildataXmlClient.h>
+#include <WiFiClientSecure.h>
+#include <LittleFS.h>
+
+static rdStation station;
+static stnMessages messages;
+static rdStation goodStation;
+static stnMessages goodMessages;
+static std::string details;
+static std::string board;
+
+static void progress(int state, int id) {}
+
+// Each update gets the response for the kind of request it makes, spoilt by the given function
+static int update(raildataXmlClient &client, std::function<std::string(const std::string &body)> spoil) {
+    hostResponder = [&](const std::string &request) {
+        return spoil(request.find("WithDetails") != std::string::npos ? details : board);
+    };
+    delay(60000);   // Leave time for the request budget to refill
+    int result = client.updateDepartures(&station, &messages, "CLJ", "token", MAXBOARDSERVICES, true, "");
+    hostResponder = nullptr;
+    return result;
+}
+
+// The caller's board must be untouched. Only a response that's missing nothing but its closing tags after the
+// last service may be accepted, and that holds the same board as before.
+static void expectRejected(raildataXmlClient &client, std::function<std::string(const std::string &body)> spoil, const char *what, long position, bool mayAccept = false) {
+    int result = update(client, spoil);
+    CHECK(mayAccept || (result != UPD_SUCCESS && result != UPD_NO_CHANGE), "%s at %ld accepted (%d)", what, position, result);
+    CHECK(memcmp(&station, &goodStation, sizeof(station)) == 0, "%s at %ld changed the board (%d)", what, position, result);
+    CHECK(memcmp(&messages, &goodMessages, sizeof(messages)) == 0, "%s at %ld changed the messages (%d)", what, position, result);
+}
+
+// Replaces the first occurrence of from
+static std::string replaced(const std::string &text, const char *from, const char *to) {
+    std::string result = text;
+    size_t p = result.find(from);
+    if (p != std::string::npos) result.replace(p, strlen(from), to);
+    return result;
+}
+
+int main() {
+    details = readDataFile("darwin_details.xml");
+    board = readDataFile("darwin_board.xml");
+
+    LittleFS.remove(WSDLCACHEFILE);
+    raildataXmlClient client;
+    hostResponses.push_back(hostHttpResponse(readDataFile("darwin_wsdl.xml")));
+    CHECK(client.init("lite.realtime.nationalrail.co.uk", "/OpenLDBWS/wsdl.aspx?ver=2021-11-01", progress) == UPD_SUCCESS, "init");
+
+    auto whole = [](const std::string &body) { return hostHttpResponse(body); };
+    CHECK(update(client, whole) == UPD_SUCCESS, "first update");
+    CHECK(update(client, whole) == UPD_NO_CHANGE, "second update");
+    CHECK(station.numServices == MAXBOARDSERVICES, "board has %d services", station.numServices);
+    goodStation = station;
+    goodMessages = messages;
+
+    // Cut short, with a Content-Length that matches what was sent, and with one for the whole body (the connection
+    // dropped). Both responses have the same services, so the shorter board response is used for the offsets.
+    long lastService = board.rfind("</lt8:service>");
+    for (long n = 0; n < (long)board.size(); n += n < lastService - 200 ? 97 : 1) {
+        bool complete = n >= lastService + (long)strlen("</lt8:service>");
+        expectRejected(client, [n](const std::string &body) {
+            return hostHttpResponse(body.substr(0, body.size() - board.size() + n));
+        }, "Truncated", n, complete);
+        expectRejected(client, [n](const std::string &body) {
+            std::string response = hostHttpResponse(body);
+            response.resize(response.size() - board.size() + n);
+            return response;
+        }, "Connection dropped", n, complete);
+    }
+
+    // Corrupt
+    auto with = [](const char *from, const char *to) {
+        return [from, to](const std::string &body) { return hostHttpResponse(replaced(body, from, to)); };
+    };
+    expectRejected(client, [](const std::string &body) { return hostHttpResponse(""); }, "Empty body", 0);
+    expectRejected(client, [](const std::string &body) { return hostHttpResponse("<html><body>Service Unavailable</body></html>"); }, "HTML page", 0);
+    expectRejected(client, [](const std::string &body) { return hostHttpResponse("Service Unavailable"); }, "Plain text", 0);
+    expectRejected(client, with("<lt8:service>", "<lt8:service><lt8:service>"), "Unclosed element", 0);
+    expectRejected(client, with("</lt4:std>", ""), "Missing end tag", 0);
+    expectRejected(client, with("<lt4:etd>", "<lt4:etd<"), "Broken start tag", 0);
+    expectRejected(client, with("<lt4:locationName>", "<lt4:locationName><"), "Stray <", 0);
+    expectRejected(client, with("</soap:Body>", ""), "Missing envelope end", 0, true);
+
+    // After all that, a good response is still read
+    CHECK(update(client, whole) == UPD_NO_CHANGE, "recovery");
+    CHECK(memcmp(&station, &goodStation, sizeof(station)) == 0, "recovered board differs");
+
+    // Text that doesn't fit the arena is cut short. The board is still shown, but the status says why it's short.
+    CHECK(client.getLastError().indexOf("truncated") < 0, "truncation reported: %s", client.getLastError().c_str());
+    std::string reason = "<lt4:delayReason>" + std::string(MAXMESSAGESIZE - 1, 'x') + "</lt4:delayReason><lt4:length>";
+    auto longReasons = [&reason](const std::string &body) {
+        std::string response = body;
+        for (size_t p = 0; (p = response.find("<lt4:length>", p)) != std::string::npos; p += reason.size()) response.replace(p, strlen("<lt4:length>"), reason);
+        return hostHttpResponse(response);
+    };
+    int result = update(client, longReasons);
+    CHECK(result == UPD_SUCCESS, "long reasons rejected (%d) %s", result, client.getLastError().c_str());
+    CHECK(client.getLastError().indexOf("truncated") >= 0, "truncation not reported: %s", client.getLastError().c_str());
+
+    printf("%d failed\n", checkFailures);
+    return checkFailures;
+}